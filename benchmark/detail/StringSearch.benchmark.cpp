@@ -0,0 +1,90 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/detail/StringSearch.h"
+
+#include <catch2/catch_all.hpp>
+#include <random>
+
+namespace {
+
+/**
+ * Creates a payload resembling a large SDP or log file, consisting of lines of text.
+ */
+std::string make_payload(const size_t size) {
+    static constexpr const char* kLines[] {
+        "a=rtpmap:98 L24/48000/8", "a=source-filter: incl IN IP4 239.1.1.1 192.168.1.1", "a=ptime:1",
+        "a=ts-refclk:ptp=IEEE1588-2008:00-1D-C1-FF-FE-12-34-56:0", "a=mediaclk:direct=0", "m=audio 5004 RTP/AVP 98",
+    };
+
+    std::mt19937 rng(42);
+    std::string payload;
+    while (payload.size() < size) {
+        payload += kLines[rng() % std::size(kLines)];
+        payload += "\r\n";
+    }
+    return payload;
+}
+
+size_t find_nth_legacy(const std::string_view haystack, const std::string_view needle, const size_t nth) {
+    size_t pos = std::string_view::npos;
+    for (size_t i = 0; i < nth; ++i) {
+        pos = haystack.find(needle, pos + 1);
+        if (pos == std::string_view::npos)
+            return pos;
+    }
+    return pos;
+}
+
+void benchmark_find(const std::string_view name, const std::string_view haystack, const std::string_view needle) {
+    BENCHMARK(std::string(name) + ": std::string_view::find") {
+        return haystack.find(needle);
+    };
+
+    BENCHMARK(std::string(name) + ": find (scalar)") {
+        return rdk::detail::find_nth(haystack, needle, 1, rdk::detail::SimdLevel::kScalar);
+    };
+
+#if RDK_SIMD_X86
+    BENCHMARK(std::string(name) + ": find (SSE2)") {
+        return rdk::detail::find_nth(haystack, needle, 1, rdk::detail::SimdLevel::kSse2);
+    };
+
+    if (rdk::detail::simd_level() >= rdk::detail::SimdLevel::kAvx2) {
+        BENCHMARK(std::string(name) + ": find (AVX2)") {
+            return rdk::detail::find_nth(haystack, needle, 1, rdk::detail::SimdLevel::kAvx2);
+        };
+    }
+#endif
+}
+
+}  // namespace
+
+TEST_CASE("StringSearch find", "[StringSearch][benchmark]") {
+    // The needles are only found at the very end of the payloads.
+    const auto large = make_payload(1 << 20) + "a=framecount:48\r\na=x-end-of-payload-marker-with-a-long-name\r\n";
+    const auto small = make_payload(256) + "a=framecount:48\r\n";
+
+    benchmark_find("Short needle, 256 B haystack", small, "a=framecount");
+    benchmark_find("Short needle, 1 MB haystack", large, "a=framecount");
+    benchmark_find("Long needle, 1 MB haystack", large, "a=x-end-of-payload-marker-with-a-long-name");
+    benchmark_find("Single character, 1 MB haystack", large, "x");
+}
+
+TEST_CASE("StringSearch find_nth", "[StringSearch][benchmark]") {
+    const auto payload = make_payload(1 << 20);
+
+    for (const size_t nth : {10, 1'000, 20'000}) {
+        const auto suffix = " (" + std::to_string(nth) + "th line ending)";
+
+        BENCHMARK("Repeated std::string_view::find" + suffix) {
+            return find_nth_legacy(payload, "\r\n", nth);
+        };
+
+        BENCHMARK("find_nth" + suffix) {
+            return rdk::detail::find_nth(payload, "\r\n", nth);
+        };
+    }
+}
@@ -0,0 +1,69 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/metrics/Registry.h"
+#include "rdk/metrics/ScopedTimer.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST_CASE("Metrics record overhead", "[metrics][benchmark]") {
+    rdk::metrics::Counter counter;
+    rdk::metrics::Gauge gauge;
+    rdk::metrics::Histogram histogram;
+
+    std::mt19937_64 random(42);
+    std::vector<uint64_t> latencies(1024);
+    for (auto& latency : latencies) {
+        latency = random() % 10'000'000;
+    }
+    size_t next = 0;
+
+    BENCHMARK("Counter::increment") {
+        counter.increment();
+    };
+
+    BENCHMARK("Gauge::add") {
+        gauge.add(1);
+    };
+
+    BENCHMARK("Gauge::track") {
+        const auto in_flight = gauge.track();
+    };
+
+    BENCHMARK("Histogram::record") {
+        histogram.record(latencies[next++ % latencies.size()]);
+    };
+
+    BENCHMARK("std::chrono::steady_clock::now") {
+        return std::chrono::steady_clock::now();
+    };
+
+    BENCHMARK("ScopedTimer") {
+        const rdk::metrics::ScopedTimer timer(histogram);
+    };
+}
+
+TEST_CASE("Metrics export", "[metrics][benchmark]") {
+    rdk::metrics::Registry registry;
+    for (int i = 0; i < 100; ++i) {
+        const auto suffix = std::to_string(i);
+        registry.counter("counter_" + suffix + "_total", "A counter").add(static_cast<uint64_t>(i));
+        registry.gauge("gauge_" + suffix, "A gauge").set(i);
+        auto& histogram = registry.histogram("histogram_" + suffix, "A histogram");
+        for (uint64_t value = 1; value < 1'000'000; value *= 3) {
+            histogram.record(value);
+        }
+    }
+
+    std::vector<char> buffer(registry.write_prometheus().size());
+
+    BENCHMARK("Registry::write_prometheus (300 metrics)") {
+        return registry.write_prometheus(buffer.data(), buffer.size());
+    };
+}
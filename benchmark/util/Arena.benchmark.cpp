@@ -0,0 +1,129 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/Arena.h"
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t kNumNodes = 100'000;
+
+struct Node {
+    Node* next {nullptr};
+    uint64_t value {0};
+};
+
+/**
+ * Frees other allocations of random sizes between the nodes, like a heap which has been in use for a while, so that
+ * consecutively allocated nodes don't end up next to each other.
+ */
+class FragmentedHeap {
+  public:
+    FragmentedHeap() {
+        std::mt19937 random(42);
+        for (size_t i = 0; i < kNumNodes * 2; ++i) {
+            blocks_.emplace_back(std::make_unique<char[]>(16 + random() % 256));
+        }
+        std::shuffle(blocks_.begin(), blocks_.end(), random);
+        blocks_.resize(kNumNodes);
+    }
+
+  private:
+    std::vector<std::unique_ptr<char[]>> blocks_;
+};
+
+uint64_t sum_list(const Node* node) {
+    uint64_t sum = 0;
+    for (; node != nullptr; node = node->next) {
+        sum += node->value;
+    }
+    return sum;
+}
+
+}  // namespace
+
+TEST_CASE("Arena allocation throughput", "[Arena][benchmark]") {
+    BENCHMARK("new and delete, 100k nodes") {
+        std::vector<Node*> nodes(kNumNodes);
+        for (auto& node : nodes) {
+            node = new Node();
+        }
+        for (auto* node : nodes) {
+            delete node;
+        }
+        return nodes.size();
+    };
+
+    BENCHMARK("Arena::make and release, 100k nodes") {
+        rdk::Arena arena;
+        std::vector<Node*> nodes(kNumNodes);
+        for (auto& node : nodes) {
+            node = arena.make<Node>();
+        }
+        return nodes.size();
+    };
+
+    BENCHMARK("new and delete, 100k strings") {
+        std::vector<std::string*> strings(kNumNodes);
+        for (auto& str : strings) {
+            str = new std::string("a string which doesn't fit the small buffer");
+        }
+        for (auto* str : strings) {
+            delete str;
+        }
+        return strings.size();
+    };
+
+    BENCHMARK("Arena::make and release, 100k strings") {
+        rdk::Arena arena;
+        for (size_t i = 0; i < kNumNodes; ++i) {
+            arena.make<std::string>("a string which doesn't fit the small buffer");
+        }
+        return arena.bytes_allocated();
+    };
+
+#if RDK_HAS_MEMORY_RESOURCE
+    BENCHMARK("std::pmr::monotonic_buffer_resource, 100k nodes") {
+        std::pmr::monotonic_buffer_resource resource;
+        std::pmr::polymorphic_allocator<Node> allocator(&resource);
+        for (size_t i = 0; i < kNumNodes; ++i) {
+            Catch::Benchmark::deoptimize_value(allocator.allocate(1));
+        }
+        return kNumNodes;
+    };
+#endif
+}
+
+TEST_CASE("Arena traversal", "[Arena][benchmark]") {
+    // Build the same linked list with both allocators, while the heap is fragmented.
+    FragmentedHeap fragmented_heap;
+    std::vector<std::unique_ptr<Node>> heap_nodes;
+    rdk::Arena arena;
+    Node* heap_list = nullptr;
+    Node* arena_list = nullptr;
+
+    for (size_t i = 0; i < kNumNodes; ++i) {
+        heap_nodes.push_back(std::make_unique<Node>(Node {heap_list, i}));
+        heap_list = heap_nodes.back().get();
+        arena_list = arena.make<Node>(Node {arena_list, i});
+    }
+
+    REQUIRE(sum_list(heap_list) == sum_list(arena_list));
+
+    BENCHMARK("Traverse 100k nodes allocated with new") {
+        return sum_list(heap_list);
+    };
+
+    BENCHMARK("Traverse 100k nodes allocated from an Arena") {
+        return sum_list(arena_list);
+    };
+}
@@ -0,0 +1,87 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/AsyncSubscriberList.h"
+
+#include <catch2/catch_all.hpp>
+#include <thread>
+
+namespace {
+
+constexpr size_t kSampleRate = 48'000;
+
+struct MeterEvent {
+    uint32_t channel;
+    float peak;
+    float rms;
+};
+
+struct MeterSubscriber {
+    float peak {};
+
+    void on_meter(const MeterEvent& event) {
+        peak = std::max(peak, event.peak);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("AsyncSubscriberList throughput", "[AsyncSubscriberList][benchmark]") {
+    rdk::AsyncSubscriberList<MeterSubscriber, MeterEvent, 1024> list;
+    MeterSubscriber subscriber;
+    auto subscription = list.add(&subscriber);
+
+    BENCHMARK("Post and dispatch one event") {
+        list.post({1, 0.5f, 0.25f});
+        return list.dispatch_member(&MeterSubscriber::on_meter);
+    };
+
+    for (const size_t block_size : {32, 128, 512}) {
+        // One event per block, for one second of audio.
+        const size_t num_blocks = kSampleRate / block_size;
+
+        BENCHMARK("One second of events at " + std::to_string(block_size) + " frames per block") {
+            for (size_t i = 0; i < num_blocks; ++i) {
+                if (!list.post({static_cast<uint32_t>(i), 0.5f, 0.25f})) {
+                    list.dispatch_member(&MeterSubscriber::on_meter);
+                }
+            }
+            return list.dispatch_member(&MeterSubscriber::on_meter);
+        };
+    }
+}
+
+TEST_CASE("AsyncSubscriberList latency", "[AsyncSubscriberList][benchmark]") {
+    rdk::AsyncSubscriberList<MeterSubscriber, MeterEvent, 1024> list;
+    MeterSubscriber subscriber;
+    auto subscription = list.add(&subscriber);
+
+    std::atomic<size_t> num_received {0};
+    std::atomic<bool> done {false};
+
+    std::thread consumer([&] {
+        while (!done.load()) {
+            const auto n = list.dispatch_member(&MeterSubscriber::on_meter);
+            if (n > 0) {
+                num_received.fetch_add(n);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    size_t num_posted = 0;
+
+    BENCHMARK("Post to dispatch round trip across threads") {
+        list.post({1, 0.5f, 0.25f});
+        num_posted++;
+        while (num_received.load() < num_posted) {
+            std::this_thread::yield();
+        }
+    };
+
+    done.store(true);
+    consumer.join();
+}
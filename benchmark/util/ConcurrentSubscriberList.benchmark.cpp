@@ -0,0 +1,103 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ConcurrentSubscriberList.h"
+#include "rdk/util/SubscriberList.h"
+
+#include <catch2/catch_all.hpp>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+struct Subscriber {
+    int value {0};
+
+    void callback() {
+        ++value;
+    }
+};
+
+constexpr size_t kNumSubscribers = 8;
+
+}  // namespace
+
+TEST_CASE("ConcurrentSubscriberList dispatch latency", "[ConcurrentSubscriberList][benchmark]") {
+    std::vector<Subscriber> subscribers(kNumSubscribers);
+    Subscriber churning_subscriber;
+
+    SECTION("Without churn") {
+        rdk::ConcurrentSubscriberList<Subscriber> list;
+        std::vector<rdk::Subscription> subscriptions;
+        for (auto& s : subscribers) {
+            subscriptions.push_back(list.add(&s));
+        }
+
+        BENCHMARK("ConcurrentSubscriberList::call") {
+            list.call([](Subscriber& s) { s.callback(); });
+        };
+
+        rdk::SubscriberList<Subscriber> locked_list;
+        std::mutex mutex;
+        std::vector<rdk::Subscription> locked_subscriptions;
+        for (auto& s : subscribers) {
+            locked_subscriptions.push_back(locked_list.add(&s));
+        }
+
+        BENCHMARK("SubscriberList::call guarded by a mutex") {
+            std::lock_guard lock(mutex);
+            locked_list.call([](Subscriber& s) { s.callback(); });
+        };
+    }
+
+    SECTION("With concurrent subscribe/unsubscribe churn") {
+        rdk::ConcurrentSubscriberList<Subscriber> list;
+        std::vector<rdk::Subscription> subscriptions;
+        for (auto& s : subscribers) {
+            subscriptions.push_back(list.add(&s));
+        }
+
+        std::atomic<bool> done {false};
+        std::thread churn([&] {
+            while (!done.load()) {
+                auto subscription = list.add(&churning_subscriber);
+                std::this_thread::yield();
+            }
+        });
+
+        BENCHMARK("ConcurrentSubscriberList::call") {
+            list.call([](Subscriber& s) { s.callback(); });
+        };
+
+        done.store(true);
+        churn.join();
+
+        rdk::SubscriberList<Subscriber> locked_list;
+        std::mutex mutex;
+        std::vector<rdk::Subscription> locked_subscriptions;
+        for (auto& s : subscribers) {
+            locked_subscriptions.push_back(locked_list.add(&s));
+        }
+
+        done.store(false);
+        std::thread locked_churn([&] {
+            while (!done.load()) {
+                std::unique_lock lock(mutex);
+                auto subscription = locked_list.add(&churning_subscriber);
+                subscription.reset();
+                lock.unlock();
+                std::this_thread::yield();
+            }
+        });
+
+        BENCHMARK("SubscriberList::call guarded by a mutex") {
+            std::lock_guard lock(mutex);
+            locked_list.call([](Subscriber& s) { s.callback(); });
+        };
+
+        done.store(true);
+        locked_churn.join();
+    }
+}
@@ -0,0 +1,108 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/FixedString.h"
+#include "rdk/util/StringUtilities.h"
+
+#include <algorithm>
+#include <array>
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t kNumRoutes = 4096;
+
+struct Route {
+    rdk::FixedString<24> path;
+    int output {};
+};
+
+/**
+ * Writes the path of route i, like "/audio/0042/gain", into given string.
+ */
+template<class String>
+constexpr void make_path(String& path, const size_t i) {
+    path.append("/audio/");
+    for (size_t divisor = 1000; divisor > 0; divisor /= 10) {
+        path.push_back(static_cast<char>('0' + i / divisor % 10));
+    }
+    path.append("/gain");
+}
+
+constexpr std::array<Route, kNumRoutes> make_routes() {
+    std::array<Route, kNumRoutes> routes {};
+    for (size_t i = 0; i < kNumRoutes; ++i) {
+        make_path(routes[i].path, i);
+        routes[i].output = static_cast<int>(i);
+    }
+    return routes;
+}
+
+template<class Routes>
+constexpr bool is_valid(const Routes& routes) {
+    for (size_t i = 0; i < routes.size(); ++i) {
+        if (!rdk::starts_with(routes[i].path, "/") || rdk::ends_with(routes[i].path, "/"))
+            return false;
+        if (i > 0 && !(std::string_view(routes[i - 1].path) < std::string_view(routes[i].path)))
+            return false;
+    }
+    return true;
+}
+
+constexpr auto kRoutes = make_routes();
+static_assert(is_valid(kRoutes));
+
+struct RuntimeRoute {
+    std::string path;
+    int output {};
+};
+
+/**
+ * Builds and validates the same table at runtime, like it would be done at startup without constexpr.
+ */
+std::vector<RuntimeRoute> make_runtime_routes() {
+    std::vector<RuntimeRoute> routes(kNumRoutes);
+    for (size_t i = 0; i < kNumRoutes; ++i) {
+        make_path(routes[i].path, i);
+        routes[i].output = static_cast<int>(i);
+    }
+    if (!is_valid(routes)) {
+        routes.clear();
+    }
+    return routes;
+}
+
+template<class Routes>
+int lookup(const Routes& routes, const std::string_view path) {
+    const auto it = std::lower_bound(routes.begin(), routes.end(), path, [](const auto& route, const auto& key) {
+        return std::string_view(route.path) < key;
+    });
+    return it != routes.end() && std::string_view(it->path) == path ? it->output : -1;
+}
+
+}  // namespace
+
+TEST_CASE("FixedString routing table", "[FixedString][benchmark]") {
+    const auto runtime_routes = make_runtime_routes();
+    REQUIRE(runtime_routes.size() == kNumRoutes);
+
+    BENCHMARK("Build and validate 4k routes at startup") {
+        return make_runtime_routes();
+    };
+
+    BENCHMARK("Use 4k routes built at compile time") {
+        return kRoutes.data();
+    };
+
+    BENCHMARK("Lookup in runtime table") {
+        return lookup(runtime_routes, "/audio/2048/gain");
+    };
+
+    BENCHMARK("Lookup in compile time table") {
+        return lookup(kRoutes, "/audio/2048/gain");
+    };
+}
@@ -0,0 +1,122 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/FlatStringMap.h"
+
+#include <catch2/catch_all.hpp>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+constexpr size_t kNumKeys = 10'000;
+
+/**
+ * Creates a text of newline separated keys, which are looked up as slices of the text like a parser would do.
+ */
+std::string make_keys(const size_t count, const std::string& prefix) {
+    std::mt19937 rng(42);
+    std::string text;
+    for (size_t i = 0; i < count; ++i) {
+        text += prefix + std::to_string(rng() % 1'000'000) + "/" + std::to_string(i) + "\n";
+    }
+    return text;
+}
+
+std::vector<std::string_view> slices_of(const std::string& text) {
+    std::vector<std::string_view> slices;
+    size_t start = 0;
+    for (auto end = text.find('\n'); end != std::string::npos; end = text.find('\n', start)) {
+        slices.push_back(std::string_view(text).substr(start, end - start));
+        start = end + 1;
+    }
+    return slices;
+}
+
+}  // namespace
+
+TEST_CASE("FlatStringMap", "[FlatStringMap][benchmark]") {
+    const auto text = make_keys(kNumKeys, "ch/");
+    const auto missing_text = make_keys(kNumKeys, "xx/");
+    const auto keys = slices_of(text);
+    const auto missing = slices_of(missing_text);
+
+    std::unordered_map<std::string, size_t> unordered_map;
+    rdk::FlatStringMap<size_t> flat_map;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        unordered_map.emplace(keys[i], i);
+        flat_map.try_emplace(keys[i], i);
+    }
+
+    BENCHMARK("std::unordered_map insert (10k)") {
+        std::unordered_map<std::string, size_t> map;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            map.emplace(keys[i], i);
+        }
+        return map.size();
+    };
+
+    BENCHMARK("FlatStringMap insert (10k)") {
+        rdk::FlatStringMap<size_t> map;
+        for (size_t i = 0; i < keys.size(); ++i) {
+            map.try_emplace(keys[i], i);
+        }
+        return map.size();
+    };
+
+    BENCHMARK("std::unordered_map lookup (10k)") {
+        size_t sum = 0;
+        for (const auto key : keys) {
+            sum += unordered_map.find(std::string(key))->second;
+        }
+        return sum;
+    };
+
+    BENCHMARK("FlatStringMap lookup (10k)") {
+        size_t sum = 0;
+        for (const auto key : keys) {
+            sum += *flat_map.find(key);
+        }
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map miss (10k)") {
+        size_t count = 0;
+        for (const auto key : missing) {
+            count += unordered_map.count(std::string(key));
+        }
+        return count;
+    };
+
+    BENCHMARK("FlatStringMap miss (10k)") {
+        size_t count = 0;
+        for (const auto key : missing) {
+            count += flat_map.contains(key) ? 1 : 0;
+        }
+        return count;
+    };
+}
+
+TEST_CASE("hash_bytes", "[FlatStringMap][benchmark]") {
+    const auto text = make_keys(kNumKeys, "ch/");
+    const auto keys = slices_of(text);
+
+    BENCHMARK("std::hash<std::string_view> (10k keys)") {
+        size_t hash = 0;
+        for (const auto key : keys) {
+            hash ^= std::hash<std::string_view>()(key);
+        }
+        return hash;
+    };
+
+    BENCHMARK("rdk::hash_bytes (10k keys)") {
+        size_t hash = 0;
+        for (const auto key : keys) {
+            hash ^= rdk::StringHash()(key);
+        }
+        return hash;
+    };
+}
@@ -0,0 +1,88 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ParseNumbers.h"
+
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <random>
+
+namespace {
+
+constexpr size_t kInputSize = 10 * 1024 * 1024;
+
+/**
+ * Creates CSV-like telemetry: lines of comma separated values.
+ */
+template<class T>
+std::string make_input() {
+    std::mt19937_64 rng(42);
+    std::string text;
+    text.reserve(kInputSize + 64);
+
+    for (size_t i = 0; text.size() < kInputSize; ++i) {
+        if constexpr (std::is_integral_v<T>) {
+            text += std::to_string(static_cast<T>(rng() >> (rng() % 48)));
+        } else {
+            text += std::to_string(static_cast<double>(rng() % 2'000'000) / 1000.0 - 1000.0);
+        }
+        text += i % 16 == 15 ? '\n' : ',';
+    }
+
+    return text;
+}
+
+/**
+ * Parses the input value by value using from_string_strict.
+ */
+template<class T>
+size_t parse_one_by_one(const std::string_view text, std::vector<T>& values) {
+    values.clear();
+    size_t start = 0;
+    while (start < text.size()) {
+        auto end = text.find_first_of(",\n", start);
+        if (end == std::string_view::npos) {
+            end = text.size();
+        }
+        if (const auto value = rdk::from_string_strict<T>(text.substr(start, end - start))) {
+            values.push_back(*value);
+        } else {
+            return 0;
+        }
+        start = end + 1;
+    }
+    return values.size();
+}
+
+template<class T>
+void benchmark_parsing(const std::string& type_name) {
+    auto input = make_input<T>();
+    std::replace(input.begin(), input.end(), '\n', ',');
+
+    std::vector<T> values;
+    values.reserve(input.size() / 2);
+    std::vector<T> array(input.size() / 2);
+
+    BENCHMARK("from_string_strict loop, 10 MB of " + type_name) {
+        return parse_one_by_one(input, values);
+    };
+
+    BENCHMARK("parse_numbers into a vector, 10 MB of " + type_name) {
+        values.clear();
+        return rdk::parse_numbers<T>(input, ',', std::back_inserter(values)).num_values;
+    };
+
+    BENCHMARK("parse_numbers into an array, 10 MB of " + type_name) {
+        return rdk::parse_numbers(input, ',', array.data(), array.size()).num_values;
+    };
+}
+
+}  // namespace
+
+TEST_CASE("ParseNumbers", "[ParseNumbers][benchmark]") {
+    benchmark_parsing<int32_t>("int32_t");
+    benchmark_parsing<int64_t>("int64_t");
+    benchmark_parsing<double>("double");
+}
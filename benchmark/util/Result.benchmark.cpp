@@ -0,0 +1,69 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/Result.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+enum class IoError { kWouldBlock, kClosed };
+
+constexpr size_t kNumCalls = 10'000;
+
+/**
+ * A non-blocking read, which would block 3 out of 4 times.
+ */
+rdk::Result legacy_read(const size_t i, size_t& bytes_read) {
+    if (i % 4 != 0)
+        return rdk::error("Resource temporarily unavailable, would block");
+    bytes_read = i;
+    return rdk::ok();
+}
+
+rdk::Expected<size_t, rdk::Error<IoError>> read(const size_t i) {
+    if (i % 4 != 0)
+        return rdk::make_error(IoError::kWouldBlock, "Resource temporarily unavailable, would block");
+    return i;
+}
+
+}  // namespace
+
+TEST_CASE("Result", "[Result][benchmark]") {
+    BENCHMARK("Result with out parameter (10k calls, 75% errors)") {
+        size_t total = 0;
+        size_t would_block = 0;
+        for (size_t i = 0; i < kNumCalls; ++i) {
+            size_t bytes_read = 0;
+            if (const auto result = legacy_read(i, bytes_read)) {
+                total += bytes_read;
+            } else {
+                would_block += result.get_error_message().size();
+            }
+        }
+        return total + would_block;
+    };
+
+    BENCHMARK("Expected with Error (10k calls, 75% errors)") {
+        size_t total = 0;
+        size_t would_block = 0;
+        for (size_t i = 0; i < kNumCalls; ++i) {
+            if (const auto result = read(i)) {
+                total += *result;
+            } else {
+                would_block += result.error().message().size();
+            }
+        }
+        return total + would_block;
+    };
+
+    BENCHMARK("Expected with map and value_or (10k calls, 75% errors)") {
+        size_t total = 0;
+        for (size_t i = 0; i < kNumCalls; ++i) {
+            total += read(i).map([](const size_t bytes) { return bytes * 2; }).value_or(0);
+        }
+        return total;
+    };
+}
@@ -0,0 +1,34 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ScopedAtomicCounter.h"
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+
+TEST_CASE("ScopedAtomicCounter memory order", "[ScopedAtomicCounter][benchmark]") {
+    std::atomic<int64_t> atomic {0};
+
+    BENCHMARK("Plain increment and decrement (no atomic)") {
+        int64_t value = atomic.load(std::memory_order_relaxed);
+        Catch::Benchmark::deoptimize_value(++value);
+        Catch::Benchmark::deoptimize_value(--value);
+    };
+
+    BENCHMARK("ScopedAtomicCounter seq_cst") {
+        const ScopedAtomicCounter<int64_t> scoped(atomic);
+    };
+
+    BENCHMARK("ScopedAtomicCounter acq_rel") {
+        const ScopedAtomicCounter<int64_t, std::memory_order_acq_rel> scoped(atomic);
+    };
+
+    BENCHMARK("ScopedAtomicCounter relaxed") {
+        const ScopedAtomicCounter<int64_t, std::memory_order_relaxed> scoped(atomic);
+    };
+
+    REQUIRE(atomic.load() == 0);
+}
@@ -0,0 +1,76 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ScopedRollback.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+/**
+ * The previous implementation of ScopedRollback, for comparison.
+ */
+class LegacyScopedRollback {
+  public:
+    LegacyScopedRollback() = default;
+
+    ~LegacyScopedRollback() {
+        for (auto& func : rollback_functions_) {
+            if (func) {
+                func();
+            }
+        }
+    }
+
+    void add(std::function<void()>&& function_to_rollback) {
+        rollback_functions_.push_back(std::move(function_to_rollback));
+    }
+
+    void cancel() {
+        rollback_functions_.clear();
+    }
+
+  private:
+    std::vector<std::function<void()>> rollback_functions_;
+};
+
+/**
+ * Simulates a reconfiguration in 4 steps, each of which registers a rollback capturing some state.
+ */
+template<class Rollback>
+int reconfigure(const bool succeed) {
+    int a = 0, b = 0, c = 0;
+    {
+        Rollback rollback;
+        rollback.add([&a, &b, &c] { a += b + c; });
+        rollback.add([&a, &b, &c] { b += a + c; });
+        rollback.add([&a, &b, &c] { c += a + b; });
+        rollback.add([&a, &b, &c] { a += b * c; });
+        if (succeed) {
+            rollback.cancel();
+        }
+    }
+    return a + b + c;
+}
+
+}  // namespace
+
+TEST_CASE("ScopedRollback", "[ScopedRollback][benchmark]") {
+    BENCHMARK("Legacy ScopedRollback (4 steps, cancelled)") {
+        return reconfigure<LegacyScopedRollback>(true);
+    };
+
+    BENCHMARK("ScopedRollback (4 steps, cancelled)") {
+        return reconfigure<rdk::ScopedRollback<>>(true);
+    };
+
+    BENCHMARK("Legacy ScopedRollback (4 steps, rolled back)") {
+        return reconfigure<LegacyScopedRollback>(false);
+    };
+
+    BENCHMARK("ScopedRollback (4 steps, rolled back)") {
+        return reconfigure<rdk::ScopedRollback<>>(false);
+    };
+}
@@ -0,0 +1,87 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ScopedAtomicCounter.h"
+#include "rdk/util/ShardedCounter.h"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr int kIterationsPerThread = 100'000;
+
+std::vector<unsigned> thread_counts() {
+    const auto max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<unsigned> counts;
+    for (unsigned count = 1; count < max_threads; count *= 2) {
+        counts.push_back(count);
+    }
+    counts.push_back(max_threads);
+    return counts;
+}
+
+/**
+ * Runs given function kIterationsPerThread times on each of the given number of threads.
+ */
+template<class F>
+void run_on_threads(const unsigned num_threads, F f) {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (unsigned t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&f] {
+            for (int i = 0; i < kIterationsPerThread; ++i) {
+                f();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+}  // namespace
+
+TEST_CASE("ShardedCounter scaling", "[ShardedCounter][benchmark]") {
+    std::atomic<int64_t> atomic {0};
+    rdk::ShardedCounter<int64_t> sharded;
+
+    for (const auto num_threads : thread_counts()) {
+        const auto suffix = " (" + std::to_string(num_threads) + " threads)";
+
+        BENCHMARK("ScopedAtomicCounter" + suffix) {
+            run_on_threads(num_threads, [&atomic] {
+                const ScopedAtomicCounter scoped(atomic);
+                Catch::Benchmark::deoptimize_value(scoped.previous_value());
+            });
+        };
+
+        BENCHMARK("ScopedShardedCounter" + suffix) {
+            run_on_threads(num_threads, [&sharded] {
+                const rdk::ScopedShardedCounter scoped(sharded);
+            });
+        };
+    }
+
+    REQUIRE(atomic.load() == 0);
+    REQUIRE(sharded.load() == 0);
+}
+
+TEST_CASE("ShardedCounter reads", "[ShardedCounter][benchmark]") {
+    rdk::ShardedCounter<int64_t> sharded;
+    sharded.add(1000);
+
+    BENCHMARK("ShardedCounter::load_approximate") {
+        return sharded.load_approximate();
+    };
+
+    BENCHMARK("ShardedCounter::load") {
+        return sharded.load();
+    };
+}
@@ -0,0 +1,108 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/StringPool.h"
+
+#include <catch2/catch_all.hpp>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+std::vector<std::string> make_names(const size_t count) {
+    std::vector<std::string> names;
+    names.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        names.push_back("Audio Device " + std::to_string(i / 16) + " Stream " + std::to_string(i % 16));
+    }
+    return names;
+}
+
+}  // namespace
+
+TEST_CASE("StringPool map lookup", "[StringPool][benchmark]") {
+    const auto names = make_names(4'000);
+
+    // The order in which the keys are looked up.
+    std::mt19937 rng(42);
+    std::vector<size_t> order(100'000);
+    for (auto& index : order) {
+        index = rng() % names.size();
+    }
+
+    std::unordered_map<std::string, size_t> string_map;
+    std::vector<std::string> string_keys;
+    for (size_t i = 0; i < names.size(); ++i) {
+        string_map[names[i]] = i;
+    }
+    for (const auto index : order) {
+        string_keys.push_back(names[index]);
+    }
+
+    rdk::StringPool pool;
+    std::unordered_map<rdk::InternedString, size_t> interned_map;
+    std::vector<rdk::InternedString> interned_keys;
+    for (size_t i = 0; i < names.size(); ++i) {
+        interned_map[pool.intern(names[i])] = i;
+    }
+    for (const auto index : order) {
+        interned_keys.push_back(pool.intern(names[index]));
+    }
+
+    BENCHMARK("std::string keys (100k lookups)") {
+        size_t sum = 0;
+        for (const auto& key : string_keys) {
+            sum += string_map.find(key)->second;
+        }
+        return sum;
+    };
+
+    BENCHMARK("InternedString keys (100k lookups)") {
+        size_t sum = 0;
+        for (const auto key : interned_keys) {
+            sum += interned_map.find(key)->second;
+        }
+        return sum;
+    };
+
+    BENCHMARK("Interning existing strings (100k)") {
+        size_t sum = 0;
+        for (const auto& key : string_keys) {
+            sum += pool.intern(key).size();
+        }
+        return sum;
+    };
+}
+
+TEST_CASE("StringPool equality", "[StringPool][benchmark]") {
+    const auto names = make_names(4'000);
+
+    rdk::StringPool pool;
+    std::vector<rdk::InternedString> interned;
+    for (const auto& name : names) {
+        interned.push_back(pool.intern(name));
+    }
+
+    BENCHMARK("std::string equality (4k x 16)") {
+        size_t count = 0;
+        for (size_t i = 0; i < names.size(); ++i) {
+            for (size_t j = i & ~size_t {15}; j < (i & ~size_t {15}) + 16; ++j) {
+                count += names[i] == names[j] ? 1 : 0;
+            }
+        }
+        return count;
+    };
+
+    BENCHMARK("InternedString equality (4k x 16)") {
+        size_t count = 0;
+        for (size_t i = 0; i < interned.size(); ++i) {
+            for (size_t j = i & ~size_t {15}; j < (i & ~size_t {15}) + 16; ++j) {
+                count += interned[i] == interned[j] ? 1 : 0;
+            }
+        }
+        return count;
+    };
+}
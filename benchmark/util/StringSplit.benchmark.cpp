@@ -0,0 +1,82 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/StringSplit.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+std::vector<std::string> naive_split(const std::string& text, const std::string& delimiter) {
+    std::vector<std::string> tokens;
+    size_t start = 0;
+    while (true) {
+        const auto pos = text.find(delimiter, start);
+        if (pos == std::string::npos) {
+            tokens.push_back(text.substr(start));
+            return tokens;
+        }
+        tokens.push_back(text.substr(start, pos - start));
+        start = pos + delimiter.size();
+    }
+}
+
+std::string make_csv_line(const size_t num_fields) {
+    std::string line;
+    for (size_t i = 0; i < num_fields; ++i) {
+        if (i > 0) {
+            line += ", ";
+        }
+        line += std::to_string(i * 7919 % 100'000);
+    }
+    return line;
+}
+
+}  // namespace
+
+TEST_CASE("StringSplit", "[StringSplit][benchmark]") {
+    const auto line = make_csv_line(1000);
+
+    BENCHMARK("Naive split into std::vector<std::string>") {
+        return naive_split(line, ", ").size();
+    };
+
+    BENCHMARK("split") {
+        size_t count = 0;
+        for (const auto token : rdk::split(line, ", ")) {
+            count += token.size();
+        }
+        return count;
+    };
+
+    BENCHMARK("Naive split and from_string_strict") {
+        int64_t sum = 0;
+        for (const auto& token : naive_split(line, ",")) {
+            sum += rdk::from_string_strict<int>(std::string_view(token).substr(token.front() == ' ' ? 1 : 0)).value();
+        }
+        return sum;
+    };
+
+    BENCHMARK("split and from_string_strict") {
+        int64_t sum = 0;
+        for (const auto token : rdk::split(line, ',', rdk::SplitOptions::kTrim)) {
+            sum += rdk::from_string_strict<int>(token).value();
+        }
+        return sum;
+    };
+
+    const std::string sdp =
+        "v=0\r\no=- 13 0 IN IP4 192.168.1.10\r\ns=Stage Box 1\r\nc=IN IP4 239.1.2.3/31\r\nt=0 0\r\n"
+        "m=audio 5004 RTP/AVP 98\r\na=rtpmap:98 L24/48000/8\r\na=ptime:1\r\na=mediaclk:direct=0\r\n";
+
+    BENCHMARK("SDP lines, naive split") {
+        return naive_split(sdp, "\r\n").size();
+    };
+
+    BENCHMARK("SDP lines, split") {
+        const auto lines = rdk::split(sdp, "\r\n");
+        return std::distance(lines.begin(), lines.end());
+    };
+}
@@ -0,0 +1,264 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/StringUtilities.h"
+
+#include <catch2/catch_all.hpp>
+#include <cctype>
+#include <limits>
+#include <random>
+
+extern "C" {
+#include "natsort/strnatcmp.h"
+}
+
+namespace {
+
+/**
+ * Creates names like the ones found in media and channel lists, for example "Stage Box 3 Input 017".
+ */
+std::vector<std::string> make_names(const size_t num_names) {
+    static constexpr const char* kPrefixes[] {"Channel ", "channel ", "Input ", "Stage Box ", "Track ", "Media "};
+
+    std::mt19937 rng(42);
+    std::vector<std::string> names;
+    names.reserve(num_names);
+
+    for (size_t i = 0; i < num_names; ++i) {
+        std::string name = kPrefixes[rng() % std::size(kPrefixes)];
+        name += std::to_string(rng() % 1000);
+        if (rng() % 2 == 0) {
+            name += " Input 0" + std::to_string(rng() % 100);
+        }
+        names.push_back(std::move(name));
+    }
+
+    return names;
+}
+
+/**
+ * The previous NumericAwareSortFunctor, which used strnatcasecmp.
+ */
+struct LegacyNumericAwareSortFunctor {
+    bool operator()(const std::string& lhs, const std::string& rhs) const {
+        return strnatcasecmp(lhs.c_str(), rhs.c_str()) < 0;
+    }
+};
+
+/**
+ * The previous merge_strings, which compared every string against the first and appended substr() copies.
+ */
+std::string legacy_merge_strings(const std::vector<std::string>& strings, const char* couple_characters = " & ") {
+    if (strings.empty())
+        return {};
+
+    size_t count = std::numeric_limits<size_t>::max();
+    for (size_t i = 1; i < strings.size(); ++i) {
+        for (size_t ch = 0; ch < strings.front().size() && ch < strings[i].size(); ++ch) {
+            if (strings[i][ch] != strings.front()[ch]) {
+                count = std::min(count, ch);
+                break;
+            }
+        }
+    }
+    if (count == std::numeric_limits<size_t>::max()) {
+        count = 0;
+    }
+
+    std::string output = strings.front();
+    if (count == 0) {
+        for (size_t i = 1; i < strings.size(); ++i) {
+            output.append(couple_characters);
+            output.append(strings[i]);
+        }
+        return output;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (output[i] == ' ') {
+            count = i + 1;
+            break;
+        }
+    }
+
+    for (size_t i = 1; i < strings.size(); ++i) {
+        if (strings[i].size() > count) {
+            output.append(couple_characters);
+            output.append(strings[i].substr(count));
+        }
+    }
+
+    return output;
+}
+
+bool tolower_equals(const std::string_view lhs, const std::string_view rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), [](const char a, const char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+    });
+}
+
+size_t tolower_find(const std::string_view haystack, const std::string_view needle) {
+    const auto it = std::search(haystack.begin(), haystack.end(), needle.begin(), needle.end(), [](char a, char b) {
+        return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b));
+    });
+    return it == haystack.end() && !needle.empty() ? std::string_view::npos : size_t(it - haystack.begin());
+}
+
+size_t tolower_hash(const std::string_view str) {
+    std::string lower(str);
+    for (auto& c : lower) {
+        c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+    return std::hash<std::string>()(lower);
+}
+
+}  // namespace
+
+TEST_CASE("Natural sort", "[StringUtilities][benchmark]") {
+    for (const size_t num_names : {10'000, 100'000, 1'000'000}) {
+        const auto names = make_names(num_names);
+        const auto suffix = " (" + std::to_string(num_names) + " strings)";
+
+        BENCHMARK_ADVANCED("std::sort with NumericAwareSortFunctor" + suffix)(Catch::Benchmark::Chronometer meter) {
+            std::vector<std::vector<std::string>> copies(static_cast<size_t>(meter.runs()), names);
+            meter.measure([&](const int run) {
+                auto& copy = copies[static_cast<size_t>(run)];
+                std::sort(copy.begin(), copy.end(), rdk::NumericAwareSortFunctor());
+            });
+        };
+
+        BENCHMARK_ADVANCED("natural_sort" + suffix)(Catch::Benchmark::Chronometer meter) {
+            std::vector<std::vector<std::string>> copies(static_cast<size_t>(meter.runs()), names);
+            meter.measure([&](const int run) {
+                rdk::natural_sort(copies[static_cast<size_t>(run)]);
+            });
+        };
+    }
+}
+
+TEST_CASE("Natural compare", "[StringUtilities][benchmark]") {
+    const auto names = make_names(10'000);
+    std::vector<std::string_view> views(names.begin(), names.end());
+
+    BENCHMARK("strnatcasecmp") {
+        int result = 0;
+        for (size_t i = 1; i < names.size(); ++i) {
+            result += strnatcasecmp(names[i - 1].c_str(), names[i].c_str());
+        }
+        return result;
+    };
+
+    BENCHMARK("compare_natural") {
+        int result = 0;
+        for (size_t i = 1; i < views.size(); ++i) {
+            result += rdk::compare_natural(views[i - 1], views[i], false);
+        }
+        return result;
+    };
+
+    BENCHMARK_ADVANCED("std::sort with strnatcasecmp")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<std::string>> copies(static_cast<size_t>(meter.runs()), names);
+        meter.measure([&](const int run) {
+            auto& copy = copies[static_cast<size_t>(run)];
+            std::sort(copy.begin(), copy.end(), LegacyNumericAwareSortFunctor());
+        });
+    };
+
+    BENCHMARK_ADVANCED("std::sort with compare_natural")(Catch::Benchmark::Chronometer meter) {
+        std::vector<std::vector<std::string_view>> copies(static_cast<size_t>(meter.runs()), views);
+        meter.measure([&](const int run) {
+            auto& copy = copies[static_cast<size_t>(run)];
+            std::sort(copy.begin(), copy.end(), rdk::NumericAwareSortFunctor());
+        });
+    };
+}
+
+TEST_CASE("Merge strings", "[StringUtilities][benchmark]") {
+    // Channel labels of a large console, sharing a long common part.
+    std::vector<std::string> labels;
+    for (int i = 0; i < 1'000; ++i) {
+        labels.push_back("Stage box A (primary) input channel " + std::to_string(1000 + i));
+    }
+    const std::vector<std::string_view> views(labels.begin(), labels.end());
+
+    REQUIRE(rdk::merge_strings(labels) == legacy_merge_strings(labels));
+
+    BENCHMARK("Legacy merge_strings (1k labels)") {
+        return legacy_merge_strings(labels);
+    };
+
+    BENCHMARK("merge_strings (1k labels)") {
+        return rdk::merge_strings(labels);
+    };
+
+    BENCHMARK("merge_strings, string_view input (1k labels)") {
+        return rdk::merge_strings(views);
+    };
+
+    BENCHMARK("count_number_of_equal_characters_from_start (1k labels)") {
+        return rdk::count_number_of_equal_characters_from_start(views);
+    };
+}
+
+TEST_CASE("Case insensitive functions", "[StringUtilities][benchmark]") {
+    std::vector<std::string> headers;
+    for (const auto* name : {"Content-Type", "Content-Length", "Transfer-Encoding", "Access-Control-Allow-Origin"}) {
+        headers.emplace_back(name);
+        std::string upper(name);
+        std::transform(upper.begin(), upper.end(), upper.begin(), rdk::to_ascii_upper);
+        headers.push_back(upper);
+    }
+
+    BENCHMARK("std::tolower equals (8x8 header names)") {
+        size_t count = 0;
+        for (const auto& a : headers) {
+            for (const auto& b : headers) {
+                count += tolower_equals(a, b) ? 1 : 0;
+            }
+        }
+        return count;
+    };
+
+    BENCHMARK("iequals (8x8 header names)") {
+        size_t count = 0;
+        for (const auto& a : headers) {
+            for (const auto& b : headers) {
+                count += rdk::iequals(a, b) ? 1 : 0;
+            }
+        }
+        return count;
+    };
+
+    BENCHMARK("std::tolower hash (8 header names)") {
+        size_t hash = 0;
+        for (const auto& header : headers) {
+            hash ^= tolower_hash(header);
+        }
+        return hash;
+    };
+
+    BENCHMARK("ihash (8 header names)") {
+        size_t hash = 0;
+        for (const auto& header : headers) {
+            hash ^= rdk::ihash(header);
+        }
+        return hash;
+    };
+
+    // A large SDP-like text with the needle at the end.
+    std::string text;
+    while (text.size() < 1024 * 1024) {
+        text += "a=rtpmap:96 L24/48000/2\r\na=ts-refclk:ptp=IEEE1588-2008:00-1D-C1-FF-FE-12-34-56:0\r\n";
+    }
+    text += "a=MediaClk:direct=0\r\n";
+
+    BENCHMARK("std::tolower search (1 MB)") {
+        return tolower_find(text, "a=mediaclk:");
+    };
+
+    BENCHMARK("ifind (1 MB)") {
+        return rdk::ifind(text, "a=mediaclk:");
+    };
+}
@@ -0,0 +1,92 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/SubscriberList.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+struct Subscriber {
+    int value {0};
+
+    void on_value_changed(const int delta) {
+        value += delta;
+    }
+};
+
+}  // namespace
+
+TEST_CASE("SubscriberList dispatch", "[SubscriberList][benchmark]") {
+    for (const size_t num_subscribers : {1, 8, 256}) {
+        std::vector<Subscriber> subscribers(num_subscribers);
+        rdk::SubscriberList<Subscriber> list;
+        std::vector<rdk::Subscription> subscriptions;
+        for (auto& s : subscribers) {
+            subscriptions.push_back(list.add(&s));
+        }
+
+        // Captures more than fits in the small buffer of std::function on common implementations.
+        int a = 1, b = 2, c = 3;
+        const auto suffix = " (" + std::to_string(num_subscribers) + " subscribers)";
+
+        BENCHMARK("std::function" + suffix) {
+            list.call(std::function<void(Subscriber&)>([&a, &b, &c](Subscriber& s) { s.on_value_changed(a + b + c); }));
+        };
+
+        BENCHMARK("Template callback" + suffix) {
+            list.call([&a, &b, &c](Subscriber& s) { s.on_value_changed(a + b + c); });
+        };
+
+        BENCHMARK("call_member" + suffix) {
+            list.call_member(&Subscriber::on_value_changed, a + b + c);
+        };
+    }
+}
+
+TEST_CASE("SubscriberList scaling", "[SubscriberList][benchmark]") {
+    for (const size_t num_subscribers : {10, 1'000, 100'000}) {
+        std::vector<Subscriber> subscribers(num_subscribers);
+        const auto suffix = " (" + std::to_string(num_subscribers) + " subscribers)";
+
+        BENCHMARK_ADVANCED("Subscribe" + suffix)(Catch::Benchmark::Chronometer meter) {
+            std::vector<rdk::SubscriberList<Subscriber>> lists(static_cast<size_t>(meter.runs()));
+            std::vector<std::vector<rdk::Subscription>> subscriptions(static_cast<size_t>(meter.runs()));
+            for (auto& s : subscriptions) {
+                s.reserve(num_subscribers);
+            }
+
+            meter.measure([&](const int run) {
+                for (auto& s : subscribers) {
+                    subscriptions[static_cast<size_t>(run)].push_back(lists[static_cast<size_t>(run)].add(&s));
+                }
+            });
+        };
+
+        BENCHMARK_ADVANCED("Unsubscribe all" + suffix)(Catch::Benchmark::Chronometer meter) {
+            std::vector<rdk::SubscriberList<Subscriber>> lists(static_cast<size_t>(meter.runs()));
+            std::vector<std::vector<rdk::Subscription>> subscriptions(static_cast<size_t>(meter.runs()));
+            for (size_t run = 0; run < subscriptions.size(); ++run) {
+                for (auto& s : subscribers) {
+                    subscriptions[run].push_back(lists[run].add(&s));
+                }
+            }
+
+            meter.measure([&](const int run) {
+                subscriptions[static_cast<size_t>(run)].clear();
+            });
+        };
+
+        rdk::SubscriberList<Subscriber> list;
+        std::vector<rdk::Subscription> subscriptions;
+        for (auto& s : subscribers) {
+            subscriptions.push_back(list.add(&s));
+        }
+
+        BENCHMARK("Call" + suffix) {
+            list.call_member(&Subscriber::on_value_changed, 1);
+        };
+    }
+}
@@ -0,0 +1,40 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/SubscriberList.h"
+#include "rdk/util/Subscription.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+struct Subscriber {
+    int value {0};
+};
+
+}  // namespace
+
+TEST_CASE("Subscription throughput", "[Subscription][benchmark]") {
+    auto shared = std::make_shared<int>(0);
+    Subscriber subscriber;
+    auto* pointer = &subscriber;
+
+    // The storage Subscription used before it became allocation free, with the capture SubscriberList::add() creates.
+    BENCHMARK("std::function with shared_ptr and pointer capture") {
+        std::function<void()> callback([shared, pointer] { pointer->value += *shared; });
+        callback();
+    };
+
+    BENCHMARK("Subscription with shared_ptr and pointer capture") {
+        rdk::Subscription subscription([shared, pointer] { pointer->value += *shared; });
+    };
+
+    rdk::SubscriberList<Subscriber> list;
+
+    BENCHMARK("SubscriberList subscribe/unsubscribe") {
+        auto subscription = list.add(&subscriber);
+        return list.get_num_subscribers();
+    };
+}
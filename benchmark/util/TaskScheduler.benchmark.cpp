@@ -0,0 +1,66 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/TaskScheduler.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+constexpr int kNumTasks = 10'000;
+
+void run_tasks(rdk::TaskScheduler& scheduler, std::atomic<int>& count) {
+    count.store(0);
+
+    for (int i = 0; i < kNumTasks; ++i) {
+        scheduler.post([&count] { count.fetch_add(1, std::memory_order_relaxed); });
+    }
+
+    while (count.load() < kNumTasks) {
+        std::this_thread::yield();
+    }
+}
+
+}  // namespace
+
+TEST_CASE("TaskScheduler throughput", "[TaskScheduler][benchmark]") {
+    const auto max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::atomic<int> count {0};
+
+    for (size_t num_threads = 1; num_threads <= max_threads; num_threads *= 2) {
+        rdk::TaskScheduler scheduler(num_threads);
+
+        BENCHMARK(std::to_string(kNumTasks) + " tiny tasks on " + std::to_string(num_threads) + " threads") {
+            run_tasks(scheduler, count);
+        };
+    }
+
+    rdk::TaskScheduler scheduler(max_threads);
+
+    BENCHMARK("Schedule and cancel a task") {
+        auto subscription = scheduler.schedule([&count] { count.fetch_add(1, std::memory_order_relaxed); });
+    };
+}
+
+TEST_CASE("TaskScheduler timers", "[TaskScheduler][benchmark]") {
+    rdk::TaskScheduler scheduler(1);
+    std::atomic<int> count {0};
+
+    for (const size_t num_timers : {1'000, 100'000, 1'000'000}) {
+        std::vector<rdk::Subscription> subscriptions(num_timers);
+
+        BENCHMARK("Schedule and cancel " + std::to_string(num_timers) + " delayed tasks") {
+            for (size_t i = 0; i < num_timers; ++i) {
+                const auto delay = std::chrono::milliseconds(1'000 + i % 60'000);
+                subscriptions[i] = scheduler.schedule_after(delay, [&count] {
+                    count.fetch_add(1, std::memory_order_relaxed);
+                });
+            }
+            for (auto& subscription : subscriptions) {
+                subscription.reset();
+            }
+        };
+    }
+}
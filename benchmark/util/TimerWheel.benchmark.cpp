@@ -0,0 +1,80 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/TimerWheel.h"
+
+#include <catch2/catch_all.hpp>
+#include <map>
+#include <random>
+
+namespace {
+
+std::vector<uint64_t> make_expiries(const size_t num_timers) {
+    // Timeouts between 1 ms and 60 s, assuming 1 ms ticks.
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> expiries(num_timers);
+    for (auto& expiry : expiries) {
+        expiry = 1 + rng() % 60'000;
+    }
+    return expiries;
+}
+
+}  // namespace
+
+TEST_CASE("TimerWheel arm and cancel", "[TimerWheel][benchmark]") {
+    for (const size_t num_timers : {1'000, 100'000, 1'000'000}) {
+        const auto expiries = make_expiries(num_timers);
+        const auto suffix = " (" + std::to_string(num_timers) + " timers)";
+
+        rdk::TimerWheel<size_t> wheel;
+        std::vector<rdk::TimerWheel<size_t>::TimerId> ids(num_timers);
+
+        BENCHMARK("TimerWheel" + suffix) {
+            for (size_t i = 0; i < num_timers; ++i) {
+                ids[i] = wheel.arm(expiries[i], i);
+            }
+            for (const auto& id : ids) {
+                wheel.cancel(id);
+            }
+            return wheel.size();
+        };
+
+        // The usual ordered container of deadlines, which costs O(log n) per timer.
+        std::multimap<uint64_t, size_t> deadlines;
+        std::vector<std::multimap<uint64_t, size_t>::iterator> iterators(num_timers);
+
+        BENCHMARK("std::multimap" + suffix) {
+            for (size_t i = 0; i < num_timers; ++i) {
+                iterators[i] = deadlines.emplace(expiries[i], i);
+            }
+            for (const auto& it : iterators) {
+                deadlines.erase(it);
+            }
+            return deadlines.size();
+        };
+    }
+}
+
+TEST_CASE("TimerWheel advance", "[TimerWheel][benchmark]") {
+    constexpr size_t kNumTimers = 1'000'000;
+    const auto expiries = make_expiries(kNumTimers);
+
+    BENCHMARK_ADVANCED("Expire " + std::to_string(kNumTimers) + " timers")(Catch::Benchmark::Chronometer meter) {
+        std::vector<rdk::TimerWheel<size_t>> wheels(static_cast<size_t>(meter.runs()));
+        for (auto& wheel : wheels) {
+            for (size_t i = 0; i < kNumTimers; ++i) {
+                wheel.arm(expiries[i], i);
+            }
+        }
+
+        size_t num_expired = 0;
+        meter.measure([&](const int run) {
+            wheels[static_cast<size_t>(run)].advance(60'000, [&num_expired](size_t) {
+                num_expired++;
+            });
+            return num_expired;
+        });
+    };
+}
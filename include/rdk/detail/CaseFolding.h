@@ -0,0 +1,241 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Simd.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace rdk::detail {
+
+/**
+ * Locale independent, ASCII only alternative to std::tolower. Other characters are returned unchanged.
+ */
+constexpr char to_ascii_lower(const char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c + ('a' - 'A')) : c;
+}
+
+/**
+ * Converts the ASCII upper case letters in 8 characters at once to lower case, without branches (SWAR).
+ * @param word 8 characters, in any byte order.
+ * @return The folded characters.
+ */
+constexpr uint64_t to_ascii_lower(const uint64_t word) {
+    constexpr uint64_t kOnes = 0x0101010101010101;
+    constexpr uint64_t kHighBits = kOnes * 0x80;
+
+    // With the high bit cleared, adding to the 7 low bits can't carry into the next character.
+    const auto low_bits = word & ~kHighBits;
+    const auto at_least_a = low_bits + kOnes * (0x80 - 'A');
+    const auto above_z = low_bits + kOnes * (0x7f - 'Z');
+    const auto is_upper = at_least_a & ~above_z & ~word & kHighBits;
+    return word | is_upper >> 2;  // 0x80 >> 2 is 0x20, the difference between upper and lower case.
+}
+
+/**
+ * Loads up to 8 characters into a word, padding with zeros.
+ */
+inline uint64_t load_word(const char* const data, const size_t size) {
+    uint64_t word = 0;
+    std::memcpy(&word, data, size < sizeof(word) ? size : sizeof(word));
+    return word;
+}
+
+#if RDK_SIMD_X86
+
+inline __m128i to_ascii_lower_sse2(const __m128i characters) {
+    // A character is upper case if c - 'A' is at most 25, as unsigned value.
+    const auto offset = _mm_sub_epi8(characters, _mm_set1_epi8('A'));
+    const auto is_upper = _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(25)), offset);
+    return _mm_or_si128(characters, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+
+RDK_TARGET_AVX2 inline __m256i to_ascii_lower_avx2(const __m256i characters) {
+    const auto offset = _mm256_sub_epi8(characters, _mm256_set1_epi8('A'));
+    const auto is_upper = _mm256_cmpeq_epi8(_mm256_min_epu8(offset, _mm256_set1_epi8(25)), offset);
+    return _mm256_or_si256(characters, _mm256_and_si256(is_upper, _mm256_set1_epi8(0x20)));
+}
+
+inline __m128i load_lower_sse2(const char* const data) {
+    return to_ascii_lower_sse2(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+}
+
+RDK_TARGET_AVX2 inline __m256i load_lower_avx2(const char* const data) {
+    return to_ascii_lower_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)));
+}
+
+/**
+ * Compares 32 characters at a time, ignoring ASCII case.
+ * @param pos The position to start at, which is updated to the first position that wasn't compared.
+ * @return False if a difference was found.
+ */
+RDK_TARGET_AVX2 inline bool iequals_avx2(const char* const a, const char* const b, const size_t size, size_t& pos) {
+    for (; pos + 32 <= size; pos += 32) {
+        const auto eq = _mm256_cmpeq_epi8(load_lower_avx2(a + pos), load_lower_avx2(b + pos));
+        if (static_cast<uint32_t>(_mm256_movemask_epi8(eq)) != 0xffffffff)
+            return false;
+    }
+    return true;
+}
+
+/**
+ * SSE2 version of iequals_avx2(), comparing 16 characters at a time.
+ */
+inline bool iequals_sse2(const char* const a, const char* const b, const size_t size, size_t& pos) {
+    for (; pos + 16 <= size; pos += 16) {
+        const auto eq = _mm_cmpeq_epi8(load_lower_sse2(a + pos), load_lower_sse2(b + pos));
+        if (_mm_movemask_epi8(eq) != 0xffff)
+            return false;
+    }
+    return true;
+}
+
+#endif
+
+/**
+ * Compares two ranges of characters ignoring ASCII case, using the given instruction set.
+ * @param a The first range.
+ * @param b The second range.
+ * @param size The number of characters in both ranges.
+ * @param level The instruction set to use, which must be supported by the CPU.
+ * @return True if both ranges are equal ignoring case.
+ */
+inline bool iequals_runtime(const char* const a, const char* const b, const size_t size, const SimdLevel level) {
+    size_t pos = 0;
+
+#if RDK_SIMD_X86
+    if (level == SimdLevel::kAvx2 && !iequals_avx2(a, b, size, pos))
+        return false;
+    if (level != SimdLevel::kScalar && !iequals_sse2(a, b, size, pos))
+        return false;
+#else
+    (void)level;
+#endif
+
+    for (; pos < size; pos += 8) {
+        const auto remaining = size - pos;
+        if (to_ascii_lower(load_word(a + pos, remaining)) != to_ascii_lower(load_word(b + pos, remaining)))
+            return false;
+    }
+
+    return true;
+}
+
+#if RDK_SIMD_X86
+
+/**
+ * Searches 16 positions at a time ignoring ASCII case, by comparing the folded first and last character of the needle
+ * against two folded unaligned loads. Works like find_nth_sse2().
+ * @param haystack The haystack.
+ * @param needle The needle, which must be at least 1 character long.
+ * @param pos The position to start at, which is updated to the first position that wasn't searched.
+ * @return The position of the first match, or npos if not found.
+ */
+inline size_t ifind_sse2(const std::string_view haystack, const std::string_view needle, size_t& pos) {
+    constexpr size_t kBlockSize = 16;
+    const auto first = _mm_set1_epi8(to_ascii_lower(needle.front()));
+    const auto last = _mm_set1_epi8(to_ascii_lower(needle.back()));
+
+    for (; pos + needle.size() - 1 + kBlockSize <= haystack.size(); pos += kBlockSize) {
+        const auto* block = haystack.data() + pos;
+        const auto eq = _mm_and_si128(
+            _mm_cmpeq_epi8(first, load_lower_sse2(block)),
+            _mm_cmpeq_epi8(last, load_lower_sse2(block + needle.size() - 1))
+        );
+
+        for (auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq)); mask != 0; mask &= mask - 1) {
+            const auto candidate = pos + static_cast<size_t>(count_trailing_zeros(mask));
+            const auto* middle = haystack.data() + candidate + 1;
+            if (needle.size() <= 2 || iequals_runtime(middle, needle.data() + 1, needle.size() - 2, SimdLevel::kSse2))
+                return candidate;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * AVX2 version of ifind_sse2(), searching 32 positions at a time.
+ */
+RDK_TARGET_AVX2 inline size_t ifind_avx2(const std::string_view haystack, const std::string_view needle, size_t& pos) {
+    constexpr size_t kBlockSize = 32;
+    const auto first = _mm256_set1_epi8(to_ascii_lower(needle.front()));
+    const auto last = _mm256_set1_epi8(to_ascii_lower(needle.back()));
+
+    for (; pos + needle.size() - 1 + kBlockSize <= haystack.size(); pos += kBlockSize) {
+        const auto* block = haystack.data() + pos;
+        const auto eq = _mm256_and_si256(
+            _mm256_cmpeq_epi8(first, load_lower_avx2(block)),
+            _mm256_cmpeq_epi8(last, load_lower_avx2(block + needle.size() - 1))
+        );
+
+        for (auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq)); mask != 0; mask &= mask - 1) {
+            const auto candidate = pos + static_cast<size_t>(count_trailing_zeros(mask));
+            const auto* middle = haystack.data() + candidate + 1;
+            if (needle.size() <= 2 || iequals_runtime(middle, needle.data() + 1, needle.size() - 2, SimdLevel::kAvx2))
+                return candidate;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+#endif
+
+/**
+ * Finds the first occurrence of a needle ignoring ASCII case, using the given instruction set.
+ * @param haystack The string to search in.
+ * @param needle The string to search for.
+ * @param level The instruction set to use, which must be supported by the CPU.
+ * @return The position of the occurrence, or npos if not found.
+ */
+inline size_t ifind_runtime(const std::string_view haystack, const std::string_view needle, const SimdLevel level) {
+    if (needle.empty())
+        return 0;
+    if (needle.size() > haystack.size())
+        return std::string_view::npos;
+
+    size_t pos = 0;
+
+#if RDK_SIMD_X86
+    if (level != SimdLevel::kScalar) {
+        const auto found = level == SimdLevel::kAvx2 ? ifind_avx2(haystack, needle, pos)
+                                                     : ifind_sse2(haystack, needle, pos);
+        if (found != std::string_view::npos)
+            return found;
+    }
+#endif
+
+    // Search the part which is too short for a full block.
+    for (; pos + needle.size() <= haystack.size(); ++pos) {
+        if (iequals_runtime(haystack.data() + pos, needle.data(), needle.size(), level))
+            return pos;
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * Hashes a string ignoring ASCII case, 8 characters at a time.
+ * @param str The string to hash.
+ * @return The hash, which is equal for strings which only differ in ASCII case.
+ */
+inline size_t ihash_runtime(const std::string_view str) {
+    constexpr uint64_t kMultiplier = 0x9e3779b97f4a7c15;
+
+    uint64_t hash = str.size() * kMultiplier;
+    for (size_t pos = 0; pos < str.size(); pos += 8) {
+        hash = (hash ^ to_ascii_lower(load_word(str.data() + pos, str.size() - pos))) * kMultiplier;
+        hash ^= hash >> 29;
+    }
+    hash ^= hash >> 32;
+    return static_cast<size_t>(hash);
+}
+
+}  // namespace rdk::detail
@@ -0,0 +1,139 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace rdk::detail {
+
+/**
+ * Hash map from pointers to small values, using open addressing with linear probing in a single array. Unlike
+ * std::unordered_map it doesn't allocate per element, it only allocates when it grows. A nullptr marks an empty slot, so
+ * nullptr can't be used as key. Erasing uses backward shift deletion, like FlatStringMap.
+ *
+ * @tparam Key The type pointed to by the keys.
+ * @tparam Value The type of the values, which must be cheap to copy.
+ */
+template<class Key, class Value>
+class FlatPointerMap {
+  public:
+    /**
+     * Inserts a value if the key is not already in the map.
+     * @param key The key, which must not be nullptr.
+     * @param value The value, only used if the key was inserted.
+     * @return A pointer to the value in the map, and whether the value was inserted. The pointer is invalidated by the
+     * next insertion or erasure.
+     */
+    std::pair<Value*, bool> try_emplace(Key* const key, const Value& value) {
+        if (auto* existing = find(key))
+            return {existing, false};
+
+        if ((size_ + 1) * 4 > entries_.size() * 3) {
+            rehash(entries_.empty() ? kMinCapacity : entries_.size() * 2);
+        }
+
+        auto index = ideal_index(key);
+        while (entries_[index].key != nullptr) {
+            index = (index + 1) & mask();
+        }
+        entries_[index] = Entry {key, value};
+        size_++;
+        return {&entries_[index].value, true};
+    }
+
+    /**
+     * @param key The key to look up.
+     * @return A pointer to the value, or nullptr if the key is not in the map.
+     */
+    [[nodiscard]] Value* find(const Key* const key) {
+        const auto index = find_index(key);
+        return index == kNotFound ? nullptr : &entries_[index].value;
+    }
+
+    [[nodiscard]] const Value* find(const Key* const key) const {
+        return const_cast<FlatPointerMap*>(this)->find(key);
+    }
+
+    /**
+     * Removes a key and its value.
+     * @param key The key to remove.
+     * @return True if the key was removed, or false if it was not in the map.
+     */
+    bool erase(const Key* const key) {
+        auto hole = find_index(key);
+        if (hole == kNotFound)
+            return false;
+
+        // Shift the following entries of the cluster back, unless that would move them before their ideal slot.
+        for (auto next = (hole + 1) & mask(); entries_[next].key != nullptr; next = (next + 1) & mask()) {
+            const auto ideal = ideal_index(entries_[next].key);
+            if (((next - ideal) & mask()) >= ((next - hole) & mask())) {
+                entries_[hole] = entries_[next];
+                hole = next;
+            }
+        }
+
+        entries_[hole] = Entry {};
+        size_--;
+        return true;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return size_;
+    }
+
+  private:
+    static constexpr size_t kMinCapacity = 16;  // Must be a power of two.
+    static constexpr size_t kNotFound = ~size_t {0};
+
+    struct Entry {
+        Key* key {nullptr};
+        Value value {};
+    };
+
+    std::vector<Entry> entries_;
+    size_t size_ {0};
+
+    [[nodiscard]] size_t mask() const {
+        return entries_.size() - 1;
+    }
+
+    [[nodiscard]] size_t ideal_index(const Key* const key) const {
+        // Fibonacci hashing, which spreads the (aligned, so low entropy) low bits of the pointer over the whole table.
+        const auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(key)) * 0x9e3779b97f4a7c15;
+        return static_cast<size_t>(hash >> 32) & mask();
+    }
+
+    [[nodiscard]] size_t find_index(const Key* const key) const {
+        if (size_ == 0)
+            return kNotFound;
+
+        for (auto index = ideal_index(key);; index = (index + 1) & mask()) {
+            if (entries_[index].key == key)
+                return index;
+            if (entries_[index].key == nullptr)
+                return kNotFound;
+        }
+    }
+
+    void rehash(const size_t capacity) {
+        auto old_entries = std::exchange(entries_, std::vector<Entry>(capacity));
+        for (const auto& entry : old_entries) {
+            if (entry.key == nullptr)
+                continue;
+            auto index = ideal_index(entry.key);
+            while (entries_[index].key != nullptr) {
+                index = (index + 1) & mask();
+            }
+            entries_[index] = entry;
+        }
+    }
+};
+
+}  // namespace rdk::detail
@@ -0,0 +1,144 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))
+    #define RDK_SIMD_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+    #endif
+#else
+    #define RDK_SIMD_X86 0
+#endif
+
+/**
+ * Marks a function as using AVX2 instructions, so that it can be compiled without enabling AVX2 for the whole program.
+ * Such functions must only be called after checking simd_level() at runtime.
+ */
+#if RDK_SIMD_X86 && (defined(__GNUC__) || defined(__clang__))
+    #define RDK_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define RDK_TARGET_AVX2
+#endif
+
+/**
+ * Whether __builtin_is_constant_evaluated() is available, which allows constexpr functions to use SIMD code paths at
+ * runtime. It's available in C++17 mode since GCC 9, Clang 9 and MSVC 19.25.
+ */
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define RDK_HAS_IS_CONSTANT_EVALUATED 1
+    #endif
+#endif
+#if !defined(RDK_HAS_IS_CONSTANT_EVALUATED)
+    #if (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+        #define RDK_HAS_IS_CONSTANT_EVALUATED 1
+    #else
+        #define RDK_HAS_IS_CONSTANT_EVALUATED 0
+    #endif
+#endif
+
+namespace rdk::detail {
+
+/**
+ * C++17 replacement for std::is_constant_evaluated().
+ * @return True if called during constant evaluation. Without compiler support this always returns true, so that
+ * constexpr functions take their portable (scalar) code path.
+ */
+constexpr bool is_constant_evaluated() {
+#if RDK_HAS_IS_CONSTANT_EVALUATED
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * The instruction sets which can be used for vectorized code paths, in increasing order of capability.
+ */
+enum class SimdLevel { kScalar, kSse2, kAvx2 };
+
+/**
+ * Detects the most capable instruction set supported by the CPU (and the OS) this program is running on.
+ * @return The detected level, which is determined once and then cached.
+ */
+inline SimdLevel simd_level() {
+    static const SimdLevel level = [] {
+#if RDK_SIMD_X86
+    #if defined(_MSC_VER) && !defined(__clang__)
+        int info[4] {};
+        __cpuid(info, 0);
+        if (info[0] >= 7) {
+            __cpuid(info, 1);
+            const bool os_saves_ymm = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+            __cpuidex(info, 7, 0);
+            if (os_saves_ymm && (info[1] & (1 << 5)) != 0) {
+                return SimdLevel::kAvx2;
+            }
+        }
+    #else
+        if (__builtin_cpu_supports("avx2")) {
+            return SimdLevel::kAvx2;
+        }
+    #endif
+        return SimdLevel::kSse2;
+#else
+        return SimdLevel::kScalar;
+#endif
+    }();
+    return level;
+}
+
+/**
+ * @return The number of set bits in given mask.
+ */
+inline int popcount(const uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    // __popcnt requires the POPCNT instruction, which is not part of SSE2.
+    auto bits = mask - ((mask >> 1) & 0x55555555);
+    bits = (bits & 0x33333333) + ((bits >> 2) & 0x33333333);
+    return static_cast<int>((((bits + (bits >> 4)) & 0x0f0f0f0f) * 0x01010101) >> 24);
+#else
+    return __builtin_popcount(mask);
+#endif
+}
+
+/**
+ * @return The index of the lowest set bit in given mask, which must not be 0.
+ */
+inline int count_trailing_zeros(const uint32_t mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, mask);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(mask);
+#endif
+}
+
+/**
+ * @return The index of the highest set bit in given value, which must not be 0.
+ */
+inline int highest_bit_index(const uint64_t value) {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<int>(index);
+#elif defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#else
+    int index = 63;
+    while ((value >> index) == 0) {
+        --index;
+    }
+    return index;
+#endif
+}
+
+}  // namespace rdk::detail
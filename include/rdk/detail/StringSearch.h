@@ -0,0 +1,252 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Simd.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+namespace rdk::detail {
+
+/**
+ * Processes the candidate positions of a single block, given as bit mask of positions at which both the first and the
+ * last byte of the needle match.
+ * @param mask The candidates, bit i being position base + i.
+ * @param haystack The haystack.
+ * @param base The position of the block in the haystack.
+ * @param needle The needle, which must be at least 1 character long.
+ * @param remaining The number of matches still to find, decremented for every match.
+ * @return The position of the match which brought remaining to 0, or npos if there was no such match in this block.
+ */
+inline size_t match_candidates(
+    uint32_t mask,
+    const std::string_view haystack,
+    const size_t base,
+    const std::string_view needle,
+    size_t& remaining
+) {
+    if (needle.size() <= 2) {
+        // The candidates are matches already, so whole blocks can be counted at once.
+        const auto num_matches = static_cast<size_t>(popcount(mask));
+        if (num_matches < remaining) {
+            remaining -= num_matches;
+            return std::string_view::npos;
+        }
+
+        for (; remaining > 1; --remaining) {
+            mask &= mask - 1;
+        }
+        remaining = 0;
+        return base + static_cast<size_t>(count_trailing_zeros(mask));
+    }
+
+    for (; mask != 0; mask &= mask - 1) {
+        const auto pos = base + static_cast<size_t>(count_trailing_zeros(mask));
+        if (std::memcmp(haystack.data() + pos + 1, needle.data() + 1, needle.size() - 2) == 0 && --remaining == 0) {
+            return pos;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+#if RDK_SIMD_X86
+
+/**
+ * Searches 16 positions at a time, by comparing the first and last byte of the needle against two unaligned loads
+ * (Wojciech Muła's "generic SIMD" substring search). Stops when the blocks would read past the end of the haystack.
+ * @param haystack The haystack.
+ * @param needle The needle, which must be at least 1 character long.
+ * @param remaining The number of matches still to find.
+ * @param pos The position to start at, which is updated to the first position that wasn't searched.
+ * @return The position of the match which brought remaining to 0, or npos if not found.
+ */
+inline size_t find_nth_sse2(
+    const std::string_view haystack,
+    const std::string_view needle,
+    size_t& remaining,
+    size_t& pos
+) {
+    constexpr size_t kBlockSize = 16;
+    const auto first = _mm_set1_epi8(needle.front());
+    const auto last = _mm_set1_epi8(needle.back());
+
+    for (; pos + needle.size() - 1 + kBlockSize <= haystack.size(); pos += kBlockSize) {
+        const auto* block = haystack.data() + pos;
+        const auto block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        const auto block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + needle.size() - 1));
+        const auto eq = _mm_and_si128(_mm_cmpeq_epi8(first, block_first), _mm_cmpeq_epi8(last, block_last));
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+
+        if (mask != 0) {
+            const auto found = match_candidates(mask, haystack, pos, needle, remaining);
+            if (found != std::string_view::npos)
+                return found;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * AVX2 version of find_nth_sse2(), searching 32 positions at a time.
+ */
+RDK_TARGET_AVX2 inline size_t find_nth_avx2(
+    const std::string_view haystack,
+    const std::string_view needle,
+    size_t& remaining,
+    size_t& pos
+) {
+    constexpr size_t kBlockSize = 32;
+    const auto first = _mm256_set1_epi8(needle.front());
+    const auto last = _mm256_set1_epi8(needle.back());
+
+    for (; pos + needle.size() - 1 + kBlockSize <= haystack.size(); pos += kBlockSize) {
+        const auto* block = haystack.data() + pos;
+        const auto block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block));
+        const auto block_last = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + needle.size() - 1));
+        const auto eq = _mm256_and_si256(_mm256_cmpeq_epi8(first, block_first), _mm256_cmpeq_epi8(last, block_last));
+        const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(eq));
+
+        if (mask != 0) {
+            const auto found = match_candidates(mask, haystack, pos, needle, remaining);
+            if (found != std::string_view::npos)
+                return found;
+        }
+    }
+
+    return std::string_view::npos;
+}
+
+#endif
+
+/**
+ * Runtime part of mismatch(), comparing 16 bytes at a time with SSE2 where available and 8 bytes at a time otherwise.
+ */
+inline size_t mismatch_runtime(const std::string_view lhs, const std::string_view rhs) {
+    const auto size = std::min(lhs.size(), rhs.size());
+    const auto* a = lhs.data();
+    const auto* b = rhs.data();
+    size_t pos = 0;
+
+#if RDK_SIMD_X86
+    for (; pos + 16 <= size; pos += 16) {
+        const auto eq = _mm_cmpeq_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + pos)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + pos))
+        );
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(eq));
+        if (mask != 0xffff)
+            return pos + static_cast<size_t>(count_trailing_zeros(~mask));
+    }
+#endif
+
+    for (; pos + 8 <= size; pos += 8) {
+        uint64_t word_a;
+        uint64_t word_b;
+        std::memcpy(&word_a, a + pos, sizeof(word_a));
+        std::memcpy(&word_b, b + pos, sizeof(word_b));
+        if (word_a != word_b)
+            break;  // The byte loop below finds the exact position, regardless of endianness.
+    }
+
+    while (pos < size && a[pos] == b[pos]) {
+        ++pos;
+    }
+    return pos;
+}
+
+/**
+ * Finds the first position at which two strings differ.
+ * @param lhs The first string.
+ * @param rhs The second string.
+ * @return The length of the common prefix, which is at most the size of the shorter string.
+ */
+constexpr size_t mismatch(const std::string_view lhs, const std::string_view rhs) {
+    if (!is_constant_evaluated())
+        return mismatch_runtime(lhs, rhs);
+
+    size_t pos = 0;
+    while (pos < lhs.size() && pos < rhs.size() && lhs[pos] == rhs[pos]) {
+        ++pos;
+    }
+    return pos;
+}
+
+/**
+ * Finds the nth occurrence of a needle in a single pass. Occurrences may overlap, which matches repeatedly calling
+ * std::string_view::find starting one position after the previous occurrence.
+ * @param haystack The string to search in.
+ * @param needle The string to search for.
+ * @param nth The occurrence to find, 1 being the first occurrence. 0 never finds anything.
+ * @param level The instruction set to use, which must be supported by the CPU. Ignored in constant expressions.
+ * @return The position of the occurrence, or npos if there are less than nth occurrences.
+ */
+constexpr size_t find_nth(
+    const std::string_view haystack,
+    const std::string_view needle,
+    const size_t nth,
+    const SimdLevel level
+) {
+    if (nth == 0)
+        return std::string_view::npos;
+
+    if (needle.empty())
+        return nth - 1 <= haystack.size() ? nth - 1 : std::string_view::npos;
+
+    // For finding a single character, memchr is as fast as it gets.
+    if (needle.size() == 1 && nth == 1)
+        return haystack.find(needle.front());
+
+    size_t remaining = nth;
+    size_t pos = 0;
+
+#if RDK_SIMD_X86
+    if (level != SimdLevel::kScalar && !is_constant_evaluated()) {
+        const auto found = level == SimdLevel::kAvx2 ? find_nth_avx2(haystack, needle, remaining, pos)
+                                                     : find_nth_sse2(haystack, needle, remaining, pos);
+        if (found != std::string_view::npos)
+            return found;
+    }
+#else
+    (void)level;
+#endif
+
+    // Search the part which is too short for a full block.
+    for (pos = haystack.find(needle, pos); pos != std::string_view::npos; pos = haystack.find(needle, pos + 1)) {
+        if (--remaining == 0)
+            return pos;
+    }
+
+    return std::string_view::npos;
+}
+
+/**
+ * Finds the nth occurrence of a needle, using the most capable instruction set supported by the CPU. Can be used in
+ * constant expressions, in which case the scalar search is used.
+ * @param haystack The string to search in.
+ * @param needle The string to search for.
+ * @param nth The occurrence to find, 1 being the first occurrence. 0 never finds anything.
+ * @return The position of the occurrence, or npos if there are less than nth occurrences.
+ */
+constexpr size_t find_nth(const std::string_view haystack, const std::string_view needle, const size_t nth) {
+    return find_nth(haystack, needle, nth, is_constant_evaluated() ? SimdLevel::kScalar : simd_level());
+}
+
+/**
+ * Finds the first occurrence of a needle, using the most capable instruction set supported by the CPU. Can be used in
+ * constant expressions.
+ * @param haystack The string to search in.
+ * @param needle The string to search for.
+ * @return The position of the occurrence, or npos if not found.
+ */
+constexpr size_t find(const std::string_view haystack, const std::string_view needle) {
+    return find_nth(haystack, needle, 1);
+}
+
+}  // namespace rdk::detail
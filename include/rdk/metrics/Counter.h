@@ -0,0 +1,50 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace rdk::metrics {
+
+/**
+ * Monotonically increasing counter, for example the number of handled requests. Lock-free, and padded to its own cache
+ * line so that counters which are updated from different threads don't slow each other down.
+ */
+class alignas(64) Counter {
+  public:
+    Counter() = default;
+
+    RDK_DECLARE_NON_COPYABLE(Counter)
+    RDK_DECLARE_NON_MOVEABLE(Counter)
+
+    /**
+     * Adds to the counter.
+     * @param amount The amount to add.
+     */
+    void add(const uint64_t amount) {
+        value_.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    void increment() {
+        add(1);
+    }
+
+    /**
+     * @return The current value.
+     */
+    [[nodiscard]] uint64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<uint64_t> value_ {0};
+};
+
+}  // namespace rdk::metrics
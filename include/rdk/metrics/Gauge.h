@@ -0,0 +1,73 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+#include "rdk/util/ScopedAtomicCounter.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace rdk::metrics {
+
+/**
+ * Value which can go up and down, for example the number of requests in flight or the size of a queue. Lock-free, and
+ * padded to its own cache line like Counter.
+ */
+class alignas(64) Gauge {
+  public:
+    Gauge() = default;
+
+    RDK_DECLARE_NON_COPYABLE(Gauge)
+    RDK_DECLARE_NON_MOVEABLE(Gauge)
+
+    /**
+     * Sets the gauge to given value.
+     * @param value The new value.
+     */
+    void set(const int64_t value) {
+        value_.store(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Adds to the gauge.
+     * @param amount The amount to add, which may be negative.
+     */
+    void add(const int64_t amount) {
+        value_.fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    void increment() {
+        add(1);
+    }
+
+    void decrement() {
+        add(-1);
+    }
+
+    /**
+     * Increments the gauge for the lifetime of the returned object, to track work in flight.
+     * Example:
+     *     const auto in_flight = requests_in_flight.track();
+     * @return An object which decrements the gauge when it goes out of scope.
+     */
+    [[nodiscard]] ScopedAtomicCounter<int64_t, std::memory_order_relaxed> track() {
+        return ScopedAtomicCounter<int64_t, std::memory_order_relaxed>(value_);
+    }
+
+    /**
+     * @return The current value.
+     */
+    [[nodiscard]] int64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<int64_t> value_ {0};
+};
+
+}  // namespace rdk::metrics
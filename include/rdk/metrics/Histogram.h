@@ -0,0 +1,181 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+#include "rdk/detail/Simd.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rdk::metrics {
+
+/**
+ * Lock-free histogram of unsigned values, typically latencies in nanoseconds, with log-linear buckets like HDR
+ * histograms: every power of two range is split into 16 equally sized buckets. This covers the full range of uint64_t
+ * in a fixed set of buckets, with a relative error of at most 6.25%. Recording a value is a couple of instructions to
+ * find the bucket, and two relaxed atomic additions.
+ */
+class Histogram {
+  public:
+    static constexpr int kSubBucketBits = 4;
+    static constexpr size_t kSubBucketCount = size_t {1} << kSubBucketBits;
+    static constexpr size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+    /**
+     * A copy of the state of a histogram, for computing statistics.
+     */
+    class Snapshot {
+      public:
+        /**
+         * @return The number of recorded values.
+         */
+        [[nodiscard]] uint64_t count() const {
+            return count_;
+        }
+
+        /**
+         * @return The sum of all recorded values.
+         */
+        [[nodiscard]] uint64_t sum() const {
+            return sum_;
+        }
+
+        /**
+         * @return The mean of all recorded values, or 0 if no values were recorded.
+         */
+        [[nodiscard]] double mean() const {
+            return count_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(count_);
+        }
+
+        /**
+         * @param index The index of the bucket.
+         * @return The number of values recorded in the bucket.
+         */
+        [[nodiscard]] uint64_t bucket(const size_t index) const {
+            return buckets_[index];
+        }
+
+        /**
+         * @param quantile The quantile, between 0.0 and 1.0 (for example 0.99 for the 99th percentile).
+         * @return The upper bound of the bucket which holds the value at given quantile, or 0 if no values were
+         * recorded.
+         */
+        [[nodiscard]] uint64_t value_at_quantile(const double quantile) const {
+            if (count_ == 0)
+                return 0;
+
+            const auto clamped = quantile < 0.0 ? 0.0 : (quantile > 1.0 ? 1.0 : quantile);
+            auto rank = static_cast<uint64_t>(std::ceil(clamped * static_cast<double>(count_)));
+            rank = rank == 0 ? 1 : (rank > count_ ? count_ : rank);
+
+            uint64_t seen = 0;
+            for (size_t i = 0; i < kBucketCount; ++i) {
+                seen += buckets_[i];
+                if (seen >= rank)
+                    return bucket_upper_bound(i);
+            }
+            return bucket_upper_bound(kBucketCount - 1);
+        }
+
+      private:
+        friend class Histogram;
+
+        std::vector<uint64_t> buckets_;
+        uint64_t count_ {0};
+        uint64_t sum_ {0};
+    };
+
+    Histogram() = default;
+
+    RDK_DECLARE_NON_COPYABLE(Histogram)
+    RDK_DECLARE_NON_MOVEABLE(Histogram)
+
+    /**
+     * Records a value.
+     * @param value The value to record.
+     */
+    void record(const uint64_t value) {
+        buckets_[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+        sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * Takes a snapshot without blocking writers. Values recorded during the call may or may not be included, and the
+     * sum may include values which the buckets don't (or vice versa).
+     * @return The snapshot.
+     */
+    [[nodiscard]] Snapshot snapshot() const {
+        Snapshot snapshot;
+        snapshot.buckets_.resize(kBucketCount);
+        for (size_t i = 0; i < kBucketCount; ++i) {
+            snapshot.buckets_[i] = buckets_[i].load(std::memory_order_relaxed);
+            snapshot.count_ += snapshot.buckets_[i];
+        }
+        snapshot.sum_ = sum_.load(std::memory_order_relaxed);
+        return snapshot;
+    }
+
+    /**
+     * @param index The index of the bucket.
+     * @return The number of values recorded in the bucket.
+     */
+    [[nodiscard]] uint64_t bucket(const size_t index) const {
+        return buckets_[index].load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return The sum of all recorded values.
+     */
+    [[nodiscard]] uint64_t sum() const {
+        return sum_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @param value A value.
+     * @return The index of the bucket holding given value.
+     */
+    static size_t bucket_index(const uint64_t value) {
+        if (value < kSubBucketCount)
+            return static_cast<size_t>(value);
+
+        // The highest kSubBucketBits + 1 bits select the bucket, the lower bits are within the bucket.
+        const auto shift = static_cast<size_t>(detail::highest_bit_index(value) - kSubBucketBits);
+        return (shift + 1) * kSubBucketCount + static_cast<size_t>(value >> shift) - kSubBucketCount;
+    }
+
+    /**
+     * @param index The index of a bucket.
+     * @return The lowest value in the bucket.
+     */
+    static constexpr uint64_t bucket_lower_bound(const size_t index) {
+        if (index < kSubBucketCount)
+            return index;
+        const auto shift = index / kSubBucketCount - 1;
+        return uint64_t {kSubBucketCount + index % kSubBucketCount} << shift;
+    }
+
+    /**
+     * @param index The index of a bucket.
+     * @return The highest value in the bucket.
+     */
+    static constexpr uint64_t bucket_upper_bound(const size_t index) {
+        if (index < kSubBucketCount)
+            return index;
+        const auto shift = index / kSubBucketCount - 1;
+        return bucket_lower_bound(index) + ((uint64_t {1} << shift) - 1);
+    }
+
+  private:
+    std::atomic<uint64_t> buckets_[kBucketCount] {};
+    std::atomic<uint64_t> sum_ {0};
+};
+
+}  // namespace rdk::metrics
@@ -0,0 +1,329 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Counter.h"
+#include "Gauge.h"
+#include "Histogram.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+#include "rdk/util/FlatStringMap.h"
+
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace rdk::metrics {
+
+namespace detail {
+
+/**
+ * Writes text into a fixed size buffer. Text which doesn't fit is dropped, but still counted, so that the caller can
+ * find out how big the buffer should have been.
+ */
+class TextWriter {
+  public:
+    TextWriter(char* const buffer, const size_t size) : buffer_(buffer), size_(size) {}
+
+    void write(const std::string_view text) {
+        for (const auto c : text) {
+            write(c);
+        }
+    }
+
+    void write(const char c) {
+        if (length_ < size_) {
+            buffer_[length_] = c;
+        }
+        length_++;
+    }
+
+    template<class Integer>
+    void write_integer(const Integer value) {
+        char digits[24];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        write(std::string_view(digits, static_cast<size_t>(result.ptr - digits)));
+    }
+
+    /**
+     * Writes text escaped for a HELP line: backslashes and line feeds are escaped.
+     */
+    void write_escaped(const std::string_view text) {
+        for (const auto c : text) {
+            if (c == '\\') {
+                write("\\\\");
+            } else if (c == '\n') {
+                write("\\n");
+            } else {
+                write(c);
+            }
+        }
+    }
+
+    /**
+     * @return The number of characters written so far, including the ones which didn't fit.
+     */
+    [[nodiscard]] size_t length() const {
+        return length_;
+    }
+
+  private:
+    char* buffer_;
+    size_t size_;
+    size_t length_ {0};
+};
+
+}  // namespace detail
+
+/**
+ * Collection of named metrics, which can be exported in the Prometheus text exposition format.
+ *
+ * Registering metrics takes a lock and allocates, so it's meant to be done once at startup, keeping the returned
+ * reference. Updating the metrics after that is lock-free, and exporting never blocks the threads which update them.
+ * Metrics live as long as the registry.
+ */
+class Registry {
+  public:
+    Registry() = default;
+
+    RDK_DECLARE_NON_COPYABLE(Registry)
+    RDK_DECLARE_NON_MOVEABLE(Registry)
+
+    /**
+     * Returns the counter with given name, which is created if it doesn't exist yet.
+     * @param name The name of the metric, which must be a valid Prometheus metric name (by convention ending in
+     * _total) and must not be used by a metric of another type.
+     * @param help A description of the metric. Only used when the metric is created.
+     * @return The counter.
+     */
+    Counter& counter(const std::string_view name, const std::string_view help = {}) {
+        return get_or_create<Counter>(name, help);
+    }
+
+    /**
+     * Returns the gauge with given name, which is created if it doesn't exist yet.
+     * @param name The name of the metric, which must be a valid Prometheus metric name and must not be used by a
+     * metric of another type.
+     * @param help A description of the metric. Only used when the metric is created.
+     * @return The gauge.
+     */
+    Gauge& gauge(const std::string_view name, const std::string_view help = {}) {
+        return get_or_create<Gauge>(name, help);
+    }
+
+    /**
+     * Returns the histogram with given name, which is created if it doesn't exist yet.
+     *
+     * The histogram records values in its fine grained buckets, but is exported with a fixed, coarse set of buckets so
+     * that every scrape has the same series. Each boundary is rounded up to the upper bound of the fine bucket holding
+     * it, which is at most 6.25% higher.
+     * @param name The name of the metric, which must be a valid Prometheus metric name and must not be used by a
+     * metric of another type.
+     * @param help A description of the metric. Only used when the metric is created.
+     * @param boundaries The upper bounds of the exported buckets, in increasing order. If empty, the buckets are
+     * exported at every power of 4 (0, 3, 15, 63 and so on). Only used when the metric is created.
+     * @return The histogram.
+     */
+    Histogram& histogram(
+        const std::string_view name,
+        const std::string_view help = {},
+        const std::vector<uint64_t>& boundaries = {}
+    ) {
+        return get_or_create<Histogram>(name, help, export_buckets(boundaries));
+    }
+
+    /**
+     * Writes the current value of all metrics in the Prometheus text exposition format, in order of registration.
+     * The metrics are read one by one while they are being updated, so the result is not an atomic snapshot of all
+     * metrics together. Histograms always list the same buckets, see histogram().
+     * @param buffer The buffer to write to. The text is not null terminated.
+     * @param size The size of the buffer.
+     * @return The length of the full text. If this is larger than the size of the buffer, the text was truncated and
+     * should be written again to a larger buffer.
+     */
+    size_t write_prometheus(char* const buffer, const size_t size) const {
+        detail::TextWriter writer(buffer, size);
+
+        std::lock_guard lock(mutex_);
+        for (const auto& entry : entries_) {
+            if (const auto* counter = std::get_if<std::unique_ptr<Counter>>(&entry.metric)) {
+                write_header(writer, entry, "counter");
+                write_sample(writer, entry.name, {}, (*counter)->value());
+            } else if (const auto* gauge = std::get_if<std::unique_ptr<Gauge>>(&entry.metric)) {
+                write_header(writer, entry, "gauge");
+                write_sample(writer, entry.name, {}, (*gauge)->value());
+            } else if (const auto* histogram = std::get_if<std::unique_ptr<Histogram>>(&entry.metric)) {
+                write_header(writer, entry, "histogram");
+                write_histogram(writer, entry.name, **histogram, entry.export_buckets);
+            }
+        }
+
+        return writer.length();
+    }
+
+    /**
+     * Convenience function which writes the metrics to a string, see write_prometheus(char*, size_t).
+     * @return The text.
+     */
+    [[nodiscard]] std::string write_prometheus() const {
+        std::string text(4096, '\0');
+        for (;;) {
+            const auto length = write_prometheus(text.data(), text.size());
+            const auto fits = length <= text.size();
+            text.resize(length);
+            if (fits)
+                return text;
+        }
+    }
+
+    /**
+     * @param name A name.
+     * @return True if the name is a valid Prometheus metric name.
+     */
+    static bool is_valid_name(const std::string_view name) {
+        if (name.empty())
+            return false;
+        for (size_t i = 0; i < name.size(); ++i) {
+            const auto c = name[i];
+            const auto is_letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':';
+            if (!is_letter && !(i > 0 && c >= '0' && c <= '9'))
+                return false;
+        }
+        return true;
+    }
+
+  private:
+    using Metric = std::variant<std::unique_ptr<Counter>, std::unique_ptr<Gauge>, std::unique_ptr<Histogram>>;
+
+    struct Entry {
+        std::string name;
+        std::string help;
+        Metric metric;
+        std::vector<size_t> export_buckets;  // Indices of the fine buckets which are exported, for histograms.
+    };
+
+    mutable std::mutex mutex_;
+    std::vector<Entry> entries_;           // Guarded by mutex_.
+    FlatStringMap<size_t> index_by_name_;  // Guarded by mutex_.
+    std::vector<Metric> detached_;         // Guarded by mutex_.
+
+    template<class T>
+    T& get_or_create(
+        const std::string_view name,
+        const std::string_view help,
+        std::vector<size_t> export_buckets = {}
+    ) {
+        assert(is_valid_name(name));
+
+        std::lock_guard lock(mutex_);
+        if (const auto* index = index_by_name_.find(name)) {
+            if (auto* existing = std::get_if<std::unique_ptr<T>>(&entries_[*index].metric))
+                return **existing;
+
+            // The name is already used by a metric of another type. Hand out a metric which is not exported, so that
+            // the caller can still use it.
+            assert(false && "Metric name is already used by a metric of another type");
+            auto metric = std::make_unique<T>();
+            auto& result = *metric;
+            detached_.emplace_back(std::move(metric));
+            return result;
+        }
+
+        auto metric = std::make_unique<T>();
+        auto& result = *metric;
+        index_by_name_.try_emplace(name, entries_.size());
+        entries_.push_back(Entry {std::string(name), std::string(help), std::move(metric), std::move(export_buckets)});
+        return result;
+    }
+
+    static void write_header(detail::TextWriter& writer, const Entry& entry, const std::string_view type) {
+        if (!entry.help.empty()) {
+            writer.write("# HELP ");
+            writer.write(entry.name);
+            writer.write(' ');
+            writer.write_escaped(entry.help);
+            writer.write('\n');
+        }
+        writer.write("# TYPE ");
+        writer.write(entry.name);
+        writer.write(' ');
+        writer.write(type);
+        writer.write('\n');
+    }
+
+    template<class Value>
+    static void write_sample(
+        detail::TextWriter& writer,
+        const std::string_view name,
+        const std::string_view suffix,
+        const Value value
+    ) {
+        writer.write(name);
+        writer.write(suffix);
+        writer.write(' ');
+        writer.write_integer(value);
+        writer.write('\n');
+    }
+
+    static std::vector<size_t> export_buckets(const std::vector<uint64_t>& boundaries) {
+        std::vector<size_t> buckets;
+        if (boundaries.empty()) {
+            for (int shift = 0; shift < 64; shift += 2) {
+                buckets.push_back(Histogram::bucket_index((uint64_t {1} << shift) - 1));
+            }
+            return buckets;
+        }
+
+        for (const auto boundary : boundaries) {
+            const auto bucket = Histogram::bucket_index(boundary);
+            assert((buckets.empty() || bucket >= buckets.back()) && "Boundaries must be in increasing order");
+            // Boundaries which round up to the same bucket are exported once.
+            if (buckets.empty() || bucket > buckets.back()) {
+                buckets.push_back(bucket);
+            }
+        }
+        return buckets;
+    }
+
+    static void write_histogram(
+        detail::TextWriter& writer,
+        const std::string_view name,
+        const Histogram& histogram,
+        const std::vector<size_t>& export_buckets
+    ) {
+        // Every bucket is read once, so that the exported buckets are cumulative even while values are recorded.
+        uint64_t count = 0;
+        auto next_export = export_buckets.begin();
+        for (size_t i = 0; i < Histogram::kBucketCount; ++i) {
+            count += histogram.bucket(i);
+            if (next_export == export_buckets.end() || *next_export != i)
+                continue;
+            ++next_export;
+            writer.write(name);
+            writer.write("_bucket{le=\"");
+            writer.write_integer(Histogram::bucket_upper_bound(i));
+            writer.write("\"} ");
+            writer.write_integer(count);
+            writer.write('\n');
+        }
+
+        writer.write(name);
+        writer.write("_bucket{le=\"+Inf\"} ");
+        writer.write_integer(count);
+        writer.write('\n');
+        write_sample(writer, name, "_sum", histogram.sum());
+        write_sample(writer, name, "_count", count);
+    }
+};
+
+}  // namespace rdk::metrics
@@ -0,0 +1,66 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Histogram.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace rdk::metrics {
+
+/**
+ * Records the time between construction and destruction into a histogram, in nanoseconds.
+ * Example:
+ *     const rdk::metrics::ScopedTimer timer(request_latency);
+ */
+class ScopedTimer {
+  public:
+    explicit ScopedTimer(Histogram& histogram) : histogram_(&histogram), start_(Clock::now()) {}
+
+    RDK_DECLARE_NON_COPYABLE(ScopedTimer)
+    RDK_DECLARE_NON_MOVEABLE(ScopedTimer)
+
+    ~ScopedTimer() {
+        stop();
+    }
+
+    /**
+     * Records the elapsed time, if not already done.
+     */
+    void stop() {
+        if (histogram_ != nullptr) {
+            histogram_->record(elapsed_nanoseconds());
+            histogram_ = nullptr;
+        }
+    }
+
+    /**
+     * Stops the timer without recording the elapsed time, for example when an operation failed and shouldn't be
+     * counted.
+     */
+    void cancel() {
+        histogram_ = nullptr;
+    }
+
+    /**
+     * @return The number of nanoseconds since construction.
+     */
+    [[nodiscard]] uint64_t elapsed_nanoseconds() const {
+        const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_).count();
+        return elapsed < 0 ? 0 : static_cast<uint64_t>(elapsed);
+    }
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    Histogram* histogram_;
+    Clock::time_point start_;
+};
+
+}  // namespace rdk::metrics
@@ -0,0 +1,228 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if __has_include(<memory_resource>)
+    #include <memory_resource>
+    #define RDK_HAS_MEMORY_RESOURCE 1
+#else
+    #define RDK_HAS_MEMORY_RESOURCE 0
+#endif
+
+namespace rdk {
+
+/**
+ * Monotonic (bump) allocator, which hands out memory from a list of chunks. Allocating is a pointer increment in the
+ * common case, and objects allocated after each other end up next to each other in memory. Memory is not freed per
+ * object, but all at once with release() or when the arena is destroyed.
+ *
+ * Objects created with make() are destroyed by release(), in reverse order of creation. Objects created with leak()
+ * are never destroyed, which is useful for objects which must outlive static destruction when the arena itself is
+ * leaked as well:
+ *     static rdk::Leak<rdk::Arena> arena;
+ *     static auto* registry = arena.get()->leak<Registry>();
+ *
+ * An arena is not thread safe.
+ */
+class Arena {
+  public:
+    static constexpr size_t kDefaultChunkSize = 4096;
+    static constexpr size_t kMaxChunkSize = 1024 * 1024;
+
+    /**
+     * Constructs an arena. No memory is allocated until the first allocation.
+     * @param initial_chunk_size The size of the first chunk. Following chunks double in size, up to kMaxChunkSize.
+     */
+    explicit Arena(const size_t initial_chunk_size = kDefaultChunkSize) :
+        next_chunk_size_(initial_chunk_size < sizeof(ChunkHeader) * 2 ? sizeof(ChunkHeader) * 2 : initial_chunk_size) {
+    }
+
+    RDK_DECLARE_NON_COPYABLE(Arena)
+    RDK_DECLARE_NON_MOVEABLE(Arena)
+
+    ~Arena() {
+        release();
+    }
+
+    /**
+     * Allocates memory, which stays valid until the arena is released.
+     * @param size The number of bytes.
+     * @param alignment The alignment, which must be a power of two.
+     * @return A pointer to the memory. Throws std::bad_alloc when no memory is available.
+     */
+    void* allocate(const size_t size, const size_t alignment = alignof(std::max_align_t)) {
+        // Sizes this large can't be allocated anyway, and would wrap around in the calculations below.
+        if (size > SIZE_MAX - alignment - sizeof(ChunkHeader))
+            throw std::bad_alloc();
+
+        auto aligned = (current_ + alignment - 1) & ~(alignment - 1);
+        if (current_ == 0 || aligned > end_ || size > end_ - aligned) {
+            add_chunk(size + alignment - 1);
+            aligned = (current_ + alignment - 1) & ~(alignment - 1);
+        }
+        current_ = aligned + size;
+        bytes_allocated_ += size;
+        return reinterpret_cast<void*>(aligned);
+    }
+
+    /**
+     * Creates an object in the arena, which is destroyed when the arena is released.
+     * @param args The arguments to construct the object with.
+     * @return A pointer to the object.
+     */
+    template<class T, class... Args>
+    T* make(Args&&... args) {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            return leak<T>(std::forward<Args>(args)...);
+        } else {
+            // Allocate the node first, so that a constructed object is never left without its destructor.
+            auto* node = static_cast<DestructorNode*>(allocate(sizeof(DestructorNode), alignof(DestructorNode)));
+            auto* object = leak<T>(std::forward<Args>(args)...);
+            destructors_ = ::new (node) DestructorNode {&destroy<T>, object, destructors_};
+            return object;
+        }
+    }
+
+    /**
+     * Creates an object in the arena, which is never destroyed. Its memory is still returned by release().
+     * @param args The arguments to construct the object with.
+     * @return A pointer to the object.
+     */
+    template<class T, class... Args>
+    T* leak(Args&&... args) {
+        return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * Destroys the objects created with make(), in reverse order of creation, and frees all memory. The arena can be
+     * used again afterwards.
+     */
+    void release() {
+        for (auto* node = destructors_; node != nullptr; node = node->next) {
+            node->destroy(node->object);
+        }
+        destructors_ = nullptr;
+
+        while (chunks_ != nullptr) {
+            auto* previous = chunks_->previous;
+            ::operator delete(chunks_);
+            chunks_ = previous;
+        }
+
+        current_ = 0;
+        end_ = 0;
+        bytes_allocated_ = 0;
+        bytes_reserved_ = 0;
+    }
+
+    /**
+     * @return The number of bytes handed out since the last release, excluding padding.
+     */
+    [[nodiscard]] size_t bytes_allocated() const {
+        return bytes_allocated_;
+    }
+
+    /**
+     * @return The number of bytes in all chunks.
+     */
+    [[nodiscard]] size_t bytes_reserved() const {
+        return bytes_reserved_;
+    }
+
+  private:
+    struct ChunkHeader {
+        ChunkHeader* previous;
+        size_t size;
+    };
+
+    struct DestructorNode {
+        void (*destroy)(void*);
+        void* object;
+        DestructorNode* next;
+    };
+
+    ChunkHeader* chunks_ {nullptr};
+    DestructorNode* destructors_ {nullptr};
+    uintptr_t current_ {0};
+    uintptr_t end_ {0};
+    size_t next_chunk_size_;
+    size_t bytes_allocated_ {0};
+    size_t bytes_reserved_ {0};
+
+    template<class T>
+    static void destroy(void* object) {
+        static_cast<T*>(object)->~T();
+    }
+
+    /**
+     * Adds a chunk which fits at least given number of bytes, and makes it the current one.
+     */
+    void add_chunk(const size_t min_size) {
+        auto size = next_chunk_size_;
+        if (size - sizeof(ChunkHeader) < min_size) {
+            size = min_size + sizeof(ChunkHeader);  // Oversized allocations get a chunk of their own.
+        } else if (next_chunk_size_ < kMaxChunkSize) {
+            next_chunk_size_ *= 2;
+        }
+
+        auto* chunk = static_cast<ChunkHeader*>(::operator new(size));
+        chunk->previous = chunks_;
+        chunk->size = size;
+        chunks_ = chunk;
+
+        current_ = reinterpret_cast<uintptr_t>(chunk + 1);
+        end_ = reinterpret_cast<uintptr_t>(chunk) + size;
+        bytes_reserved_ += size;
+    }
+};
+
+#if RDK_HAS_MEMORY_RESOURCE
+
+/**
+ * Adapts an Arena to std::pmr::memory_resource, so that it can back pmr containers. Deallocating does nothing, the
+ * memory is returned when the arena is released.
+ * Example:
+ *     rdk::Arena arena;
+ *     rdk::ArenaResource resource(arena);
+ *     std::pmr::vector<int> values(&resource);
+ */
+class ArenaResource : public std::pmr::memory_resource {
+  public:
+    explicit ArenaResource(Arena& arena) : arena_(arena) {}
+
+    /**
+     * @return The arena this resource allocates from.
+     */
+    [[nodiscard]] Arena& arena() const {
+        return arena_;
+    }
+
+  private:
+    Arena& arena_;
+
+    void* do_allocate(const size_t bytes, const size_t alignment) override {
+        return arena_.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    [[nodiscard]] bool do_is_equal(const memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+#endif
+
+}  // namespace rdk
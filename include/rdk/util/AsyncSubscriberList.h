@@ -0,0 +1,144 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "ScopedRollback.h"
+#include "SpscQueue.h"
+#include "SubscriberList.h"
+#include "Subscription.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <atomic>
+#include <functional>
+
+namespace rdk {
+
+/**
+ * Delivers events from one thread to subscribers living on another thread. The producer (for example a realtime audio
+ * thread) posts events into a bounded, wait-free queue, and the consumer (for example the message thread) periodically
+ * drains the queue and dispatches the events to the subscribers, which are held by a SubscriberList.
+ *
+ * Posting never locks, allocates or makes system calls. When the queue is full the event is dropped and counted, the
+ * overflow counter and the high water mark can be used to size the queue.
+ *
+ * There can be a single producer thread. Subscribers must be added and events must be dispatched on the consumer
+ * thread.
+ *
+ * @tparam Type The type of the subscriber.
+ * @tparam Event The type of the event payload.
+ * @tparam Capacity The maximum number of events which can be queued, must be a power of two.
+ */
+template<class Type, class Event, size_t Capacity = 1024>
+class AsyncSubscriberList {
+  public:
+    AsyncSubscriberList() = default;
+
+    RDK_DECLARE_NON_COPYABLE(AsyncSubscriberList)
+    RDK_DECLARE_NON_MOVEABLE(AsyncSubscriberList)
+
+    /**
+     * Adds given subscriber to the list. Must be called from the consumer thread.
+     * @param subscriber Subscriber to add.
+     * @return A subscription which will unsubscribe on destruction.
+     */
+    Subscription add(Type* subscriber) {
+        return subscribers_.add(subscriber);
+    }
+
+    /**
+     * Posts an event to be dispatched on the consumer thread. Must be called from the producer thread. Realtime safe.
+     * @param event The event to post.
+     * @return True if the event was queued, or false if the queue was full and the event was dropped.
+     */
+    bool post(const Event& event) {
+        if (!queue_.push(event)) {
+            num_dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const auto size = queue_.size_approx();
+        if (size > high_water_mark_.load(std::memory_order_relaxed)) {
+            high_water_mark_.store(size, std::memory_order_relaxed);
+        }
+
+        return true;
+    }
+
+    /**
+     * Dispatches all queued events by calling back given callback with each subscriber and each event. Must be called
+     * from the consumer thread. Calling dispatch() from within a dispatch (for example from a subscriber) does nothing
+     * and returns 0, the events are dispatched by the outer call.
+     * @param cb The function to call, with signature void(Type& subscriber, const Event& event).
+     * @return The number of events which were dispatched.
+     */
+    template<class F>
+    size_t dispatch(F&& cb) {
+        // The event is only removed from the queue after the subscribers were called, so a nested dispatch would
+        // deliver (and destroy) the same event again.
+        if (dispatching_)
+            return 0;
+
+        dispatching_ = true;
+        const ScopedRollback<1> reset_dispatching([this] {
+            dispatching_ = false;
+        });
+
+        size_t num_dispatched = 0;
+
+        while (queue_.consume([this, &cb](const Event& event) {
+            subscribers_.call([&cb, &event](Type& subscriber) {
+                cb(subscriber, event);
+            });
+        })) {
+            num_dispatched++;
+        }
+
+        return num_dispatched;
+    }
+
+    /**
+     * Dispatches all queued events by calling given member function on each subscriber, with each event.
+     * @param method The member function to call, for example &Type::on_event.
+     * @return The number of events which were dispatched.
+     */
+    template<class Method>
+    size_t dispatch_member(Method method) {
+        return dispatch([method](Type& subscriber, const Event& event) {
+            std::invoke(method, subscriber, event);
+        });
+    }
+
+    /**
+     * @return The number of events which were dropped because the queue was full.
+     */
+    [[nodiscard]] size_t get_num_dropped() const {
+        return num_dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return The highest number of events which were queued at the same time.
+     */
+    [[nodiscard]] size_t get_high_water_mark() const {
+        return high_water_mark_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return The number of subscribers currently in the list.
+     */
+    [[nodiscard]] size_t get_num_subscribers() const {
+        return subscribers_.get_num_subscribers();
+    }
+
+  private:
+    SpscQueue<Event, Capacity> queue_;
+    SubscriberList<Type> subscribers_;
+    std::atomic<size_t> num_dropped_ {0};
+    std::atomic<size_t> high_water_mark_ {0};
+    bool dispatching_ {false};  // Only accessed from the consumer thread.
+};
+
+}  // namespace rdk
@@ -0,0 +1,142 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "ScopedRollback.h"
+#include "SubscriberList.h"
+#include "Subscription.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <functional>
+#include <unordered_set>
+#include <vector>
+
+namespace rdk {
+
+/**
+ * List of subscribers which receive keyed notifications in batches. Notifications are queued with post(), and flush()
+ * delivers every queued key to every subscriber, in a single pass over the subscribers. Posting a key which is already
+ * queued does nothing, so no matter how often a key is posted between two flushes, each subscriber receives it at most
+ * once.
+ *
+ * The subscribers are held by a SubscriberList, so the same lifetime rules apply: subscribers which unsubscribe before
+ * (or during) a flush are not called anymore, not even for the remaining keys.
+ *
+ * @tparam Type The type of the subscriber.
+ * @tparam Key The type of the key which identifies a notification, for example a property identifier.
+ * @tparam Hash The hash function for keys, which are compared using operator==.
+ */
+template<class Type, class Key, class Hash = std::hash<Key>>
+class CoalescingSubscriberList {
+  public:
+    CoalescingSubscriberList() = default;
+
+    RDK_DECLARE_NON_COPYABLE(CoalescingSubscriberList)
+    RDK_DECLARE_NON_MOVEABLE(CoalescingSubscriberList)
+
+    /**
+     * Adds given subscriber to the list.
+     * @param subscriber Subscriber to add.
+     * @return A subscription which will unsubscribe on destruction.
+     */
+    Subscription add(Type* subscriber) {
+        return subscribers_.add(subscriber);
+    }
+
+    /**
+     * Queues a notification for given key, unless a notification for this key is already queued.
+     * @param key The key to queue.
+     * @return True if the key was queued, or false if it was already queued.
+     */
+    bool post(const Key& key) {
+        if (!pending_keys_.insert(key).second)
+            return false;
+
+        pending_.push_back(key);
+        return true;
+    }
+
+    /**
+     * Delivers all queued notifications by calling back given callback with each subscriber and each queued key.
+     * Keys posted during the flush are queued for the next flush. Calling flush() from within a flush does nothing.
+     * @param cb The function to call, with signature void(Type& subscriber, const Key& key).
+     */
+    template<class F>
+    void flush(F&& cb) {
+        if (flushing_ || pending_.empty())
+            return;
+
+        flushing_ = true;
+        std::swap(pending_, delivering_);
+        pending_keys_.clear();
+
+        const ScopedRollback<1> end_flush([this] {
+            delivering_.clear();
+            flushing_ = false;
+        });
+
+        subscribers_.call_checked([this, &cb](Type& subscriber, const auto& is_subscribed) {
+            for (const auto& key : delivering_) {
+                // A subscriber which unsubscribes (or is destroyed) while handling a key doesn't get the other keys.
+                if (!is_subscribed())
+                    return;
+                cb(subscriber, key);
+            }
+        });
+    }
+
+    /**
+     * Delivers all queued notifications by calling given member function on each subscriber, with each queued key.
+     * @param method The member function to call, for example &Type::on_property_changed.
+     */
+    template<class Method>
+    void flush_member(Method method) {
+        flush([method](Type& subscriber, const Key& key) {
+            std::invoke(method, subscriber, key);
+        });
+    }
+
+    /**
+     * Drops all queued notifications without delivering them.
+     */
+    void clear() {
+        pending_.clear();
+        pending_keys_.clear();
+    }
+
+    /**
+     * @return The number of notifications which will be delivered on the next flush.
+     */
+    [[nodiscard]] size_t get_num_pending() const {
+        return pending_.size();
+    }
+
+    /**
+     * @return The number of subscribers currently in the list.
+     */
+    [[nodiscard]] size_t get_num_subscribers() const {
+        return subscribers_.get_num_subscribers();
+    }
+
+    /**
+     * Tests whether given subscriber is part of the list.
+     * @param subscriber The subscriber to test.
+     * @return True if given subscriber is part of the list, or false if not.
+     */
+    bool has_subscriber(Type* subscriber) const {
+        return subscribers_.has_subscriber(subscriber);
+    }
+
+  private:
+    SubscriberList<Type> subscribers_;
+    std::vector<Key> pending_;  // In order of posting.
+    std::unordered_set<Key, Hash> pending_keys_;
+    std::vector<Key> delivering_;
+    bool flushing_ {false};
+};
+
+}  // namespace rdk
@@ -0,0 +1,300 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Subscription.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace rdk {
+
+/**
+ * List of subscribers which can be called from any thread while subscribers are added and removed from other threads.
+ *
+ * Writers (add and unsubscribe) build a new immutable snapshot of the list and atomically publish it. Readers (call)
+ * iterate the snapshot which was current when they started, without locking and without allocating, which makes call()
+ * wait-free and suitable for realtime threads. Old snapshots are reclaimed by the writers once no reader can be using
+ * them anymore (RCU style), so memory is never freed on the calling thread.
+ *
+ * Once a Subscription is destroyed the subscriber is guaranteed to not be called anymore, which means that
+ * unsubscribing waits for in-flight calls on other threads to finish. When unsubscribing from inside call() on the
+ * same thread the wait is skipped to prevent a deadlock.
+ *
+ * @tparam Type The type of the subscriber.
+ */
+template<class Type>
+class ConcurrentSubscriberList {
+  public:
+    ConcurrentSubscriberList() = default;
+
+    RDK_DECLARE_NON_COPYABLE(ConcurrentSubscriberList)
+    RDK_DECLARE_NON_MOVEABLE(ConcurrentSubscriberList)
+
+    /**
+     * Adds given subscriber to the list. Not realtime safe.
+     * @param subscriber Subscriber to add.
+     * @return A subscription which will unsubscribe on destruction.
+     */
+    Subscription add(Type* subscriber) {
+        if (subscriber == nullptr)
+            return {};
+
+        std::lock_guard lock(state_->mutex);
+
+        auto it = std::find_if(state_->entries.begin(), state_->entries.end(), [subscriber](const auto& entry) {
+            return entry.subscriber == subscriber;
+        });
+
+        if (it != state_->entries.end()) {
+            it->count += 1;
+        } else {
+            state_->entries.push_back(SubscriberAndCount {subscriber, 1});
+            state_->publish();
+        }
+
+        return Subscription([state = state_, subscriber] {
+            ConcurrentSubscriberList::unsubscribe(state, subscriber);
+        });
+    }
+
+    /**
+     * Calls all subscribers by calling back the given callback with each subscriber. This function is wait-free and
+     * doesn't allocate, so it can be called from a realtime thread.
+     * @param cb The function to call. Nullable callables (like an empty std::function) are ignored.
+     * @param excluding If given, this subscriber will not be called.
+     */
+    template<class F>
+    void call(F&& cb, Type* excluding = nullptr) const {
+        if constexpr (std::is_constructible_v<bool, F>) {
+            if (!static_cast<bool>(cb)) {
+                return;
+            }
+        }
+
+        const ReadGuard guard(*state_);
+
+        for (auto* subscriber : *guard.snapshot()) {
+            if (subscriber != excluding) {
+                cb(*subscriber);
+            }
+        }
+    }
+
+    /**
+     * Calls given member function on all subscribers. Like call(), this function is wait-free and doesn't allocate.
+     * @param method The member function to call, for example &Type::on_value_changed.
+     * @param args The arguments to pass to the member function. These are passed to every subscriber, so they are never
+     * moved from.
+     */
+    template<class Method, class... Args>
+    void call_member(Method method, const Args&... args) const {
+        const ReadGuard guard(*state_);
+
+        for (auto* subscriber : *guard.snapshot()) {
+            std::invoke(method, *subscriber, args...);
+        }
+    }
+
+    /**
+     * @return The number of subscribers currently in the list.
+     */
+    [[nodiscard]] size_t get_num_subscribers() const {
+        const ReadGuard guard(*state_);
+        return guard.snapshot()->size();
+    }
+
+    /**
+     * Tests whether given subscriber is part of the list.
+     * @param subscriber The subscriber to test.
+     * @return True if given subscriber is part of the list, or false if not.
+     */
+    bool has_subscriber(Type* subscriber) const {
+        const ReadGuard guard(*state_);
+        const auto* snapshot = guard.snapshot();
+        return std::find(snapshot->begin(), snapshot->end(), subscriber) != snapshot->end();
+    }
+
+  private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    using Snapshot = std::vector<Type*>;
+
+    struct SubscriberAndCount {
+        Type* subscriber;
+        size_t count;
+    };
+
+    struct RetiredSnapshot {
+        const Snapshot* snapshot;
+        uint64_t epoch;
+    };
+
+    struct alignas(kCacheLineSize) ReaderCount {
+        std::atomic<size_t> count {0};
+    };
+
+    /**
+     * Holds the state shared between the list and its subscriptions.
+     * Readers register themselves in the reader count belonging to the parity of the current epoch. A writer may only
+     * advance the epoch when the reader count of the other parity dropped to zero, which means that a snapshot retired
+     * at epoch N can no longer be referenced by any reader once the epoch reached N + 2.
+     */
+    struct State {
+        std::atomic<const Snapshot*> current {new Snapshot()};
+        std::atomic<uint64_t> epoch {0};
+        ReaderCount readers[2];
+
+        std::mutex mutex;
+        std::vector<SubscriberAndCount> entries;  // Guarded by mutex.
+        std::vector<RetiredSnapshot> retired;     // Guarded by mutex.
+
+        ~State() {
+            delete current.load();
+            for (auto& r : retired) {
+                delete r.snapshot;
+            }
+        }
+
+        /**
+         * Publishes a new snapshot of the entries. Must be called with the mutex held.
+         * @return The epoch at which the previous snapshot was retired.
+         */
+        uint64_t publish() {
+            auto* next = new Snapshot();
+            next->reserve(entries.size());
+            for (auto& entry : entries) {
+                next->push_back(entry.subscriber);
+            }
+
+            const auto retired_at = epoch.load();
+            retired.push_back(RetiredSnapshot {current.exchange(next), retired_at});
+            reclaim();
+            return retired_at;
+        }
+
+        /**
+         * Tries to advance the epoch and deletes all snapshots which can no longer be referenced by readers. Never
+         * blocks. Must be called with the mutex held.
+         */
+        void reclaim() {
+            for (int i = 0; i < 2 && !retired.empty(); ++i) {
+                const auto e = epoch.load();
+                if (readers[(e + 1) % 2].count.load() != 0)
+                    break;
+                epoch.store(e + 1);
+            }
+
+            const auto e = epoch.load();
+            retired.erase(
+                std::remove_if(
+                    retired.begin(),
+                    retired.end(),
+                    [e](const RetiredSnapshot& r) {
+                        if (r.epoch + 2 > e)
+                            return false;
+                        delete r.snapshot;
+                        return true;
+                    }
+                ),
+                retired.end()
+            );
+        }
+    };
+
+    /**
+     * Registers a reader for the duration of its lifetime and provides access to the current snapshot.
+     */
+    class ReadGuard {
+      public:
+        explicit ReadGuard(State& state) :
+            state_(state), readers_(state.readers[state.epoch.load() % 2].count), enclosing_(innermost_guard_) {
+            readers_.fetch_add(1);
+            snapshot_ = state.current.load();
+            innermost_guard_ = this;
+        }
+
+        ~ReadGuard() {
+            innermost_guard_ = enclosing_;
+            readers_.fetch_sub(1);
+        }
+
+        RDK_DECLARE_NON_COPYABLE(ReadGuard)
+        RDK_DECLARE_NON_MOVEABLE(ReadGuard)
+
+        [[nodiscard]] const Snapshot* snapshot() const {
+            return snapshot_;
+        }
+
+        /**
+         * @param state The state of a list.
+         * @return True if the calling thread is currently reading given list, possibly further up the call stack.
+         */
+        static bool is_reading(const State& state) {
+            for (auto* guard = innermost_guard_; guard != nullptr; guard = guard->enclosing_) {
+                if (&guard->state_ == &state)
+                    return true;
+            }
+            return false;
+        }
+
+      private:
+        const State& state_;
+        std::atomic<size_t>& readers_;
+        const ReadGuard* enclosing_;
+        const Snapshot* snapshot_ {nullptr};
+
+        // The guards of the calls in progress on this thread form a stack, which allows unsubscribe to find out whether
+        // it's called from within call() of the same list.
+        inline static thread_local const ReadGuard* innermost_guard_ {nullptr};
+    };
+
+    std::shared_ptr<State> state_ {std::make_shared<State>()};
+
+    static void unsubscribe(const std::shared_ptr<State>& state, Type* subscriber_to_remove) {
+        std::unique_lock lock(state->mutex);
+
+        auto& entries = state->entries;
+        auto it = std::find_if(entries.begin(), entries.end(), [subscriber_to_remove](const auto& entry) {
+            return entry.subscriber == subscriber_to_remove;
+        });
+
+        if (it == entries.end())
+            return;
+
+        if (it->count > 1) {
+            it->count -= 1;
+            return;
+        }
+
+        entries.erase(it);
+        const auto retired_at = state->publish();
+
+        // Waiting from within call() of this list on this thread would never finish, so skip waiting in that case.
+        if (ReadGuard::is_reading(*state))
+            return;
+
+        // Wait until no reader can reference the old snapshot anymore. The lock is released while waiting so that
+        // subscribers which are currently being called are able to add or remove subscriptions themselves.
+        while (state->epoch.load() < retired_at + 2) {
+            lock.unlock();
+            std::this_thread::yield();
+            lock.lock();
+            state->reclaim();
+        }
+    }
+};
+
+}  // namespace rdk
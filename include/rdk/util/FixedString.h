@@ -0,0 +1,176 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace rdk {
+
+/**
+ * String with a fixed capacity, stored inline. All operations are constexpr, which makes it possible to build tables
+ * of strings (like routing tables or protocol keywords) and validate them at compile time, so that no work is left for
+ * startup. The string is always null terminated.
+ *
+ * Example:
+ *     constexpr rdk::FixedString<16> keyword("RTP/AVP");
+ *     static_assert(keyword.size() == 7);
+ *
+ * @tparam N The maximum number of characters, excluding the null terminator.
+ */
+template<size_t N>
+class FixedString {
+  public:
+    using value_type = char;
+    using size_type = size_t;
+    using iterator = const char*;
+    using const_iterator = const char*;
+
+    constexpr FixedString() = default;
+
+    /**
+     * Constructs the string from a string literal, which must fit (checked at compile time).
+     * @param str The string literal.
+     */
+    template<size_t M>
+    constexpr FixedString(const char (&str)[M]) {
+        static_assert(M - 1 <= N, "String literal doesn't fit");
+        append(std::string_view(str, M - 1));
+    }
+
+    /**
+     * Constructs the string from a string_view, truncating it to the capacity. Use append() to detect truncation.
+     * @param str The string to copy.
+     */
+    constexpr explicit FixedString(const std::string_view str) {
+        append(str.substr(0, N));
+    }
+
+    /**
+     * Appends a string, if it fits.
+     * @param str The string to append.
+     * @return True if the string was appended, or false if it didn't fit, in which case this string is unchanged.
+     */
+    constexpr bool append(const std::string_view str) {
+        if (str.size() > N - size_)
+            return false;
+        for (const auto c : str) {
+            data_[size_++] = c;
+        }
+        data_[size_] = '\0';
+        return true;
+    }
+
+    /**
+     * Appends a character, if it fits.
+     * @param c The character to append.
+     * @return True if the character was appended, or false if the string is full.
+     */
+    constexpr bool push_back(const char c) {
+        if (size_ == N)
+            return false;
+        data_[size_++] = c;
+        data_[size_] = '\0';
+        return true;
+    }
+
+    /**
+     * Makes the string empty.
+     */
+    constexpr void clear() {
+        size_ = 0;
+        data_[0] = '\0';
+    }
+
+    /**
+     * @return The string as string_view, which points into this object.
+     */
+    [[nodiscard]] constexpr std::string_view view() const {
+        return {data_, size_};
+    }
+
+    constexpr operator std::string_view() const {
+        return view();
+    }
+
+    /**
+     * @return A pointer to the null terminated string.
+     */
+    [[nodiscard]] constexpr const char* c_str() const {
+        return data_;
+    }
+
+    [[nodiscard]] constexpr const char* data() const {
+        return data_;
+    }
+
+    /**
+     * @return The number of characters.
+     */
+    [[nodiscard]] constexpr size_t size() const {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr bool empty() const {
+        return size_ == 0;
+    }
+
+    /**
+     * @return The maximum number of characters.
+     */
+    [[nodiscard]] static constexpr size_t capacity() {
+        return N;
+    }
+
+    constexpr char operator[](const size_t index) const {
+        return data_[index];
+    }
+
+    [[nodiscard]] constexpr const char* begin() const {
+        return data_;
+    }
+
+    [[nodiscard]] constexpr const char* end() const {
+        return data_ + size_;
+    }
+
+    template<size_t M>
+    friend constexpr bool operator==(const FixedString& lhs, const FixedString<M>& rhs) {
+        return lhs.view() == rhs.view();
+    }
+
+    template<size_t M>
+    friend constexpr bool operator!=(const FixedString& lhs, const FixedString<M>& rhs) {
+        return lhs.view() != rhs.view();
+    }
+
+    template<size_t M>
+    friend constexpr bool operator<(const FixedString& lhs, const FixedString<M>& rhs) {
+        return lhs.view() < rhs.view();
+    }
+
+    friend constexpr bool operator==(const FixedString& lhs, const std::string_view rhs) {
+        return lhs.view() == rhs;
+    }
+
+    friend constexpr bool operator==(const std::string_view lhs, const FixedString& rhs) {
+        return lhs == rhs.view();
+    }
+
+    friend constexpr bool operator!=(const FixedString& lhs, const std::string_view rhs) {
+        return lhs.view() != rhs;
+    }
+
+    friend constexpr bool operator!=(const std::string_view lhs, const FixedString& rhs) {
+        return lhs != rhs.view();
+    }
+
+  private:
+    char data_[N + 1] {};
+    size_t size_ {0};
+};
+
+}  // namespace rdk
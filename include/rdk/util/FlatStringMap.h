@@ -0,0 +1,302 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace rdk {
+
+/**
+ * Hash map from strings to values, using open addressing with linear probing.
+ *
+ * Tuned for short string keys: the hashes live in their own dense array, so most probes only touch that array, and a
+ * key is only compared when the full 64 bit hash matches. Keys are stored as std::string, which keeps short keys
+ * inline (small string optimization). Lookups take a std::string_view, so looking up a slice of a larger string
+ * doesn't allocate. Erasing uses backward shift deletion, which keeps probe sequences short without tombstones.
+ *
+ * Pointers to values are invalidated when the map grows and when elements are erased.
+ *
+ * @tparam T The type of the values.
+ */
+template<class T>
+class FlatStringMap {
+  public:
+    FlatStringMap() = default;
+
+    FlatStringMap(const FlatStringMap& other) {
+        *this = other;
+    }
+
+    FlatStringMap& operator=(const FlatStringMap& other) {
+        if (this == &other)
+            return *this;
+        clear();
+        reserve(other.size_);
+        other.for_each([this](const std::string_view key, const T& value) {
+            try_emplace(key, value);
+        });
+        return *this;
+    }
+
+    FlatStringMap(FlatStringMap&& other) noexcept {
+        swap(other);
+    }
+
+    FlatStringMap& operator=(FlatStringMap&& other) noexcept {
+        if (this != &other) {
+            FlatStringMap(std::move(other)).swap(*this);
+        }
+        return *this;
+    }
+
+    ~FlatStringMap() {
+        destroy_all();
+        std::allocator<Entry>().deallocate(entries_, capacity_);
+    }
+
+    /**
+     * Inserts a value if the key is not already in the map.
+     * @param key The key.
+     * @param args The arguments to construct the value with, only used if the key was inserted.
+     * @return A pointer to the value in the map, and whether the value was inserted.
+     */
+    template<class... Args>
+    std::pair<T*, bool> try_emplace(const std::string_view key, Args&&... args) {
+        const auto hash = hash_of(key);
+        if (auto* value = find(key, hash))
+            return {value, false};
+
+        if ((size_ + 1) * 4 > capacity_ * 3) {
+            rehash(capacity_ == 0 ? kMinCapacity : capacity_ * 2);
+        }
+
+        auto index = static_cast<size_t>(hash) & (capacity_ - 1);
+        while (hashes_[index] != 0) {
+            index = (index + 1) & (capacity_ - 1);
+        }
+
+        auto* entry = ::new (static_cast<void*>(entries_ + index))
+            Entry {std::string(key), T(std::forward<Args>(args)...)};
+        hashes_[index] = hash;
+        size_++;
+        return {&entry->value, true};
+    }
+
+    /**
+     * Inserts or assigns a value.
+     * @param key The key.
+     * @param value The value.
+     * @return A pointer to the value in the map, and whether the value was inserted (as opposed to assigned).
+     */
+    template<class V>
+    std::pair<T*, bool> insert_or_assign(const std::string_view key, V&& value) {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second) {
+            *result.first = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    /**
+     * @param key The key.
+     * @return A reference to the value of given key, which is default constructed if the key was not in the map.
+     */
+    T& operator[](const std::string_view key) {
+        return *try_emplace(key).first;
+    }
+
+    /**
+     * @param key The key to look up.
+     * @return A pointer to the value, or nullptr if the key is not in the map.
+     */
+    [[nodiscard]] T* find(const std::string_view key) {
+        return find(key, hash_of(key));
+    }
+
+    [[nodiscard]] const T* find(const std::string_view key) const {
+        return const_cast<FlatStringMap*>(this)->find(key, hash_of(key));
+    }
+
+    /**
+     * @param key The key to look up.
+     * @return True if the key is in the map.
+     */
+    [[nodiscard]] bool contains(const std::string_view key) const {
+        return find(key) != nullptr;
+    }
+
+    /**
+     * Removes a key and its value.
+     * @param key The key to remove.
+     * @return True if the key was removed, or false if it was not in the map.
+     */
+    bool erase(const std::string_view key) {
+        if (size_ == 0)
+            return false;
+
+        const auto hash = hash_of(key);
+        const auto mask = capacity_ - 1;
+        auto index = static_cast<size_t>(hash) & mask;
+
+        for (;; index = (index + 1) & mask) {
+            if (hashes_[index] == 0)
+                return false;
+            if (hashes_[index] == hash && entries_[index].key == key)
+                break;
+        }
+
+        entries_[index].~Entry();
+
+        // Shift the following entries of the cluster back, unless that would move them before their ideal slot.
+        auto hole = index;
+        for (auto next = (index + 1) & mask; hashes_[next] != 0; next = (next + 1) & mask) {
+            const auto ideal = static_cast<size_t>(hashes_[next]) & mask;
+            if (((next - ideal) & mask) >= ((next - hole) & mask)) {
+                ::new (static_cast<void*>(entries_ + hole)) Entry(std::move(entries_[next]));
+                entries_[next].~Entry();
+                hashes_[hole] = hashes_[next];
+                hole = next;
+            }
+        }
+
+        hashes_[hole] = 0;
+        size_--;
+        return true;
+    }
+
+    /**
+     * Calls given function with every key and value, in no particular order. The map must not be modified while
+     * iterating.
+     * @param f The function to call, with a std::string_view and a T&.
+     */
+    template<class F>
+    void for_each(F&& f) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (hashes_[i] != 0) {
+                f(std::string_view(entries_[i].key), entries_[i].value);
+            }
+        }
+    }
+
+    template<class F>
+    void for_each(F&& f) const {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (hashes_[i] != 0) {
+                f(std::string_view(entries_[i].key), static_cast<const T&>(entries_[i].value));
+            }
+        }
+    }
+
+    /**
+     * Makes room for given number of elements without growing.
+     * @param count The number of elements.
+     */
+    void reserve(const size_t count) {
+        auto capacity = capacity_ == 0 ? kMinCapacity : capacity_;
+        while (count * 4 > capacity * 3) {
+            capacity *= 2;
+        }
+        if (capacity != capacity_) {
+            rehash(capacity);
+        }
+    }
+
+    /**
+     * Removes all elements, keeping the allocated memory.
+     */
+    void clear() {
+        destroy_all();
+        size_ = 0;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return size_;
+    }
+
+    [[nodiscard]] bool empty() const {
+        return size_ == 0;
+    }
+
+    void swap(FlatStringMap& other) noexcept {
+        std::swap(hashes_, other.hashes_);
+        std::swap(entries_, other.entries_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(size_, other.size_);
+    }
+
+  private:
+    static constexpr size_t kMinCapacity = 16;  // Must be a power of two.
+
+    struct Entry {
+        std::string key;
+        T value;
+    };
+
+    std::unique_ptr<uint64_t[]> hashes_;  // 0 marks an empty slot.
+    Entry* entries_ {nullptr};            // Only the slots with a non-zero hash are constructed.
+    size_t capacity_ {0};
+    size_t size_ {0};
+
+    static uint64_t hash_of(const std::string_view key) {
+        const auto hash = hash_bytes(key);
+        return hash == 0 ? 1 : hash;
+    }
+
+    T* find(const std::string_view key, const uint64_t hash) {
+        if (size_ == 0)
+            return nullptr;
+
+        const auto mask = capacity_ - 1;
+        for (auto index = static_cast<size_t>(hash) & mask;; index = (index + 1) & mask) {
+            if (hashes_[index] == 0)
+                return nullptr;
+            if (hashes_[index] == hash && entries_[index].key == key)
+                return &entries_[index].value;
+        }
+    }
+
+    void rehash(const size_t capacity) {
+        auto hashes = std::make_unique<uint64_t[]>(capacity);
+        auto* entries = std::allocator<Entry>().allocate(capacity);
+
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (hashes_[i] == 0)
+                continue;
+
+            auto index = static_cast<size_t>(hashes_[i]) & (capacity - 1);
+            while (hashes[index] != 0) {
+                index = (index + 1) & (capacity - 1);
+            }
+            ::new (static_cast<void*>(entries + index)) Entry(std::move(entries_[i]));
+            hashes[index] = hashes_[i];
+            entries_[i].~Entry();
+        }
+
+        std::allocator<Entry>().deallocate(entries_, capacity_);
+        hashes_ = std::move(hashes);
+        entries_ = entries;
+        capacity_ = capacity;
+    }
+
+    void destroy_all() {
+        for (size_t i = 0; i < capacity_; ++i) {
+            if (hashes_[i] != 0) {
+                entries_[i].~Entry();
+                hashes_[i] = 0;
+            }
+        }
+    }
+};
+
+}  // namespace rdk
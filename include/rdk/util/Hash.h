@@ -0,0 +1,164 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+namespace rdk {
+
+namespace detail {
+
+constexpr uint64_t kHashSecret[4] {0xa0761d6478bd642f, 0xe7037ed1a0b428db, 0x8ebc6af09c88c6e3, 0x589965cc75374cc3};
+
+/**
+ * Multiplies two 64 bit values into a 128 bit result.
+ */
+inline void multiply_128(const uint64_t a, const uint64_t b, uint64_t& low, uint64_t& high) {
+#if defined(__SIZEOF_INT128__)
+    // __extension__ keeps -Wpedantic quiet about __int128, which is not standard C++.
+    __extension__ typedef unsigned __int128 uint128;
+    const auto product = static_cast<uint128>(a) * b;
+    low = static_cast<uint64_t>(product);
+    high = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    low = _umul128(a, b, &high);
+#else
+    const auto a_low = a & 0xffffffff, a_high = a >> 32, b_low = b & 0xffffffff, b_high = b >> 32;
+    const auto low_low = a_low * b_low, low_high = a_low * b_high, high_low = a_high * b_low;
+    const auto middle = (low_low >> 32) + (low_high & 0xffffffff) + (high_low & 0xffffffff);
+    low = (low_low & 0xffffffff) | (middle << 32);
+    high = a_high * b_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+}
+
+/**
+ * Multiplies two 64 bit values and folds the 128 bit result back into 64 bits.
+ */
+inline uint64_t hash_mix(const uint64_t a, const uint64_t b) {
+    uint64_t low;
+    uint64_t high;
+    multiply_128(a, b, low, high);
+    return low ^ high;
+}
+
+inline uint64_t hash_read64(const unsigned char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint64_t hash_read32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+}  // namespace detail
+
+/**
+ * Hashes a range of bytes with a fast non-cryptographic hash (based on wyhash). Short inputs, like most string keys,
+ * are hashed with a couple of loads and a single 64x64 to 128 bit multiplication. The result depends on the byte
+ * order of the platform, so it must not be stored or sent to other machines.
+ *
+ * This has a different name than the string overload of hash_bytes() on purpose: with a single name a call like
+ * hash_bytes("abc", 1) would silently hash 1 byte instead of hashing "abc" with seed 1.
+ * @param data The bytes to hash.
+ * @param size The number of bytes.
+ * @param seed Seed, to get a different hash function.
+ * @return The hash.
+ */
+inline uint64_t hash_memory(const void* const data, const size_t size, uint64_t seed = 0) {
+    using detail::hash_mix;
+    using detail::hash_read32;
+    using detail::hash_read64;
+    using detail::kHashSecret;
+
+    const auto* p = static_cast<const unsigned char*>(data);
+    seed ^= hash_mix(seed ^ kHashSecret[0], kHashSecret[1]);
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+
+    if (size <= 16) {
+        if (size >= 4) {
+            // Two overlapping pairs of 4 byte loads cover all sizes from 4 to 16.
+            const auto offset = (size >> 3) << 2;
+            a = hash_read32(p) << 32 | hash_read32(p + offset);
+            b = hash_read32(p + size - 4) << 32 | hash_read32(p + size - 4 - offset);
+        } else if (size > 0) {
+            a = uint64_t {p[0]} << 16 | uint64_t {p[size >> 1]} << 8 | p[size - 1];
+        }
+    } else {
+        auto remaining = size;
+        if (remaining > 48) {
+            auto seed1 = seed;
+            auto seed2 = seed;
+            do {
+                seed = hash_mix(hash_read64(p) ^ kHashSecret[1], hash_read64(p + 8) ^ seed);
+                seed1 = hash_mix(hash_read64(p + 16) ^ kHashSecret[2], hash_read64(p + 24) ^ seed1);
+                seed2 = hash_mix(hash_read64(p + 32) ^ kHashSecret[3], hash_read64(p + 40) ^ seed2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+        while (remaining > 16) {
+            seed = hash_mix(hash_read64(p) ^ kHashSecret[1], hash_read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+        a = hash_read64(p + remaining - 16);
+        b = hash_read64(p + remaining - 8);
+    }
+
+    uint64_t low;
+    uint64_t high;
+    detail::multiply_128(a ^ kHashSecret[1], b ^ seed, low, high);
+    return hash_mix(low ^ kHashSecret[0] ^ size, high ^ kHashSecret[1]);
+}
+
+/**
+ * Hashes a string with hash_memory().
+ * @param str The string to hash.
+ * @param seed Seed, to get a different hash function.
+ * @return The hash.
+ */
+inline uint64_t hash_bytes(const std::string_view str, const uint64_t seed = 0) {
+    return hash_memory(str.data(), str.size(), seed);
+}
+
+/**
+ * Transparent hash function object for string keys, using hash_bytes(). Strings, string_views and string literals hash
+ * the same, so lookups don't need to construct a std::string (in containers which support heterogeneous lookup, like
+ * FlatStringMap and the C++20 unordered containers).
+ */
+struct StringHash {
+    using is_transparent = void;
+
+    size_t operator()(const std::string_view str) const {
+        return static_cast<size_t>(hash_bytes(str));
+    }
+};
+
+/**
+ * Transparent equality function object for string keys, see StringHash.
+ */
+struct StringEqual {
+    using is_transparent = void;
+
+    constexpr bool operator()(const std::string_view lhs, const std::string_view rhs) const {
+        return lhs == rhs;
+    }
+};
+
+}  // namespace rdk
@@ -0,0 +1,152 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rdk {
+
+/**
+ * The default inline capacity of InplaceFunction. Large enough to hold a handful of pointers, or a std::function which
+ * can be used as explicit fallback for callables which don't fit.
+ */
+constexpr size_t kInplaceFunctionDefaultCapacity = std::max(4 * sizeof(void*), sizeof(std::function<void()>));
+
+template<class Signature, size_t Capacity = kInplaceFunctionDefaultCapacity>
+class InplaceFunction;
+
+/**
+ * Move-only alternative to std::function which stores its callable inside the object itself, which means it never
+ * allocates. Callables which don't fit in the inline storage result in a compile time error. For those cases the
+ * callable can be explicitly wrapped in a std::function (which does allocate), or the capacity can be increased.
+ * @tparam R The return type.
+ * @tparam Args The argument types.
+ * @tparam Capacity The number of bytes available for storing the callable.
+ */
+template<class R, class... Args, size_t Capacity>
+class InplaceFunction<R(Args...), Capacity> {
+  public:
+    InplaceFunction() noexcept = default;
+
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    /**
+     * Constructs the function from given callable.
+     * @param callable The callable to store. If this is a nullable callable (like a function pointer or std::function)
+     * which is empty, the InplaceFunction will be empty as well.
+     */
+    template<
+        class F,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<F>, InplaceFunction> && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>>>
+    InplaceFunction(F&& callable) {
+        using Callable = std::decay_t<F>;
+
+        static_assert(
+            sizeof(Callable) <= Capacity,
+            "Callable doesn't fit in the inline storage of InplaceFunction. Reduce the size of the captured state or "
+            "explicitly wrap the callable in a std::function."
+        );
+        static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable is over-aligned");
+        static_assert(std::is_nothrow_move_constructible_v<Callable>, "Callable must be nothrow move constructible");
+
+        if constexpr (std::is_constructible_v<bool, Callable>) {
+            if (!static_cast<bool>(callable)) {
+                return;
+            }
+        }
+
+        ::new (static_cast<void*>(&storage_)) Callable(std::forward<F>(callable));
+        vtable_ = &kVTable<Callable>;
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+
+    InplaceFunction(InplaceFunction&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    ~InplaceFunction() {
+        reset();
+    }
+
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this == &other)
+            return *this;
+
+        reset();
+
+        if (other.vtable_ != nullptr) {
+            other.vtable_->move(&storage_, &other.storage_);
+            vtable_ = other.vtable_;
+            other.vtable_ = nullptr;
+        }
+
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        reset();
+        return *this;
+    }
+
+    /**
+     * Invokes the stored callable. Calling an empty function is undefined behaviour.
+     */
+    R operator()(Args... args) {
+        return vtable_->invoke(&storage_, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @return True if this function holds a callable, or false if empty.
+     */
+    explicit operator bool() const noexcept {
+        return vtable_ != nullptr;
+    }
+
+    /**
+     * Destroys the stored callable (without invoking it), leaving this function empty.
+     */
+    void reset() noexcept {
+        if (vtable_ != nullptr) {
+            vtable_->destroy(&storage_);
+            vtable_ = nullptr;
+        }
+    }
+
+  private:
+    struct VTable {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* destination, void* source) noexcept;
+        void (*destroy)(void* storage) noexcept;
+    };
+
+    template<class Callable>
+    static constexpr VTable kVTable {
+        [](void* storage, Args&&... args) -> R {
+            return std::invoke(*static_cast<Callable*>(storage), std::forward<Args>(args)...);
+        },
+        [](void* destination, void* source) noexcept {
+            ::new (destination) Callable(std::move(*static_cast<Callable*>(source)));
+            static_cast<Callable*>(source)->~Callable();
+        },
+        [](void* storage) noexcept {
+            static_cast<Callable*>(storage)->~Callable();
+        },
+    };
+
+    alignas(std::max_align_t) std::byte storage_[Capacity];
+    const VTable* vtable_ {nullptr};
+};
+
+}  // namespace rdk
@@ -0,0 +1,213 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "StringUtilities.h"
+#include "rdk/detail/Simd.h"
+
+#include <charconv>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace rdk {
+
+/**
+ * The result of parse_numbers().
+ */
+struct ParseNumbersResult {
+    size_t num_values {0};  // The number of values written to the output.
+
+    // The offset of the start of the field which couldn't be parsed (after leading whitespace), or npos. For a field
+    // which is only partly valid, like "1.5" when parsing integers, this is the offset of the "1".
+    size_t error_offset {std::string_view::npos};
+
+    std::errc error {};  // invalid_argument, result_out_of_range, or value_too_large if the output is full.
+
+    /**
+     * @return True if all fields were parsed.
+     */
+    explicit operator bool() const {
+        return error == std::errc();
+    }
+};
+
+namespace detail {
+
+/**
+ * Counts the number of ASCII digits at the start of given range, 16 characters at a time where possible.
+ * @param begin The start of the range.
+ * @param end The end of the range.
+ * @return The number of leading digits.
+ */
+inline size_t count_leading_digits(const char* const begin, const char* const end) {
+    const char* p = begin;
+
+#if RDK_SIMD_X86
+    const auto zero = _mm_set1_epi8('0');
+    const auto nine = _mm_set1_epi8(9);
+
+    for (; end - p >= 16; p += 16) {
+        // A character is a digit if c - '0' is at most 9, as unsigned value.
+        const auto values = _mm_sub_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)), zero);
+        const auto is_digit = _mm_cmpeq_epi8(_mm_max_epu8(values, nine), nine);
+        const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(is_digit));
+        if (mask != 0xffff) {
+            return static_cast<size_t>(p - begin) + static_cast<size_t>(count_trailing_zeros(~mask));
+        }
+    }
+#endif
+
+    while (p < end && is_ascii_digit(*p)) {
+        ++p;
+    }
+    return static_cast<size_t>(p - begin);
+}
+
+/**
+ * Parses a single integer starting at p, in the format accepted by std::from_chars.
+ * @return The end of the number and the error, like std::from_chars.
+ */
+template<class T>
+std::from_chars_result parse_integer(const char* p, const char* const end, T& value) {
+    using Unsigned = std::make_unsigned_t<T>;
+
+    const auto* const begin = p;
+    const bool negative = std::is_signed_v<T> && p < end && *p == '-';
+    if (negative) {
+        ++p;
+    }
+
+    const auto num_digits = count_leading_digits(p, end);
+    if (num_digits == 0)
+        return {begin, std::errc::invalid_argument};
+
+    // Numbers which are too long to be guaranteed to fit are left to std::from_chars, which detects overflow.
+    if (num_digits > static_cast<size_t>(std::numeric_limits<T>::digits10))
+        return std::from_chars(begin, end, value);
+
+    Unsigned magnitude = 0;
+    for (size_t i = 0; i < num_digits; ++i) {
+        magnitude = static_cast<Unsigned>(magnitude * 10 + static_cast<Unsigned>(p[i] - '0'));
+    }
+    value = static_cast<T>(negative ? Unsigned(0) - magnitude : magnitude);
+    return {p + num_digits, std::errc()};
+}
+
+/**
+ * Parses all fields of a delimited text, passing each value to given sink. The sink returns false if it can't take any
+ * more values.
+ */
+template<class T, class Sink>
+ParseNumbersResult parse_numbers(const std::string_view text, const char delimiter, Sink&& sink) {
+    ParseNumbersResult result;
+
+    const char* p = text.data();
+    const char* const end = text.data() + text.size();
+
+    const auto skip_whitespace = [&p, end, delimiter] {
+        while (p < end && *p != delimiter && is_ascii_space(*p)) {
+            ++p;
+        }
+    };
+
+    const char* field = p;  // The start of the field being parsed, after leading whitespace.
+
+    const auto fail = [&result, &text, &field](const std::errc error) {
+        result.error = error;
+        result.error_offset = static_cast<size_t>(field - text.data());
+        return result;
+    };
+
+    skip_whitespace();
+
+    while (p < end) {
+        field = p;
+        T value {};
+        std::from_chars_result parsed;
+
+        if constexpr (std::is_integral_v<T> && !std::is_same_v<T, bool>) {
+            parsed = parse_integer(p, end, value);
+        } else {
+            parsed = std::from_chars(p, end, value);
+        }
+
+        if (parsed.ec != std::errc())
+            return fail(parsed.ec);
+
+        // Only output the value once the whole field turned out to be valid.
+        p = parsed.ptr;
+        skip_whitespace();
+
+        if (p != end && *p != delimiter)
+            return fail(std::errc::invalid_argument);
+
+        if (!sink(value))
+            return fail(std::errc::value_too_large);
+
+        result.num_values++;
+
+        if (p == end)
+            break;
+
+        ++p;
+        skip_whitespace();
+    }
+
+    return result;
+}
+
+}  // namespace detail
+
+/**
+ * Parses a text containing delimited numbers in a single pass, writing the values to an output iterator. Fields are
+ * parsed like from_string_strict(), surrounded by optional whitespace. An empty text and a delimiter at the end (like a
+ * trailing newline) are accepted, empty fields in between are not. Integer fields are parsed using SIMD digit
+ * classification where available.
+ *
+ * Example:
+ *     std::vector<int> values;
+ *     const auto result = rdk::parse_numbers<int>("1, 2, 3", ',', std::back_inserter(values));
+ *
+ * @tparam T The type of the values.
+ * @param text The text to parse.
+ * @param delimiter The character separating the fields.
+ * @param out The output iterator to write the values to.
+ * @return The number of values written, and the offset and kind of the first error if any. The values before the
+ * error have been written to the output.
+ */
+template<class T, class OutputIt>
+ParseNumbersResult parse_numbers(const std::string_view text, const char delimiter, OutputIt out) {
+    return detail::parse_numbers<T>(text, delimiter, [&out](const T value) {
+        *out++ = value;
+        return true;
+    });
+}
+
+/**
+ * Parses a text containing delimited numbers in a single pass, writing the values to a caller provided array. See the
+ * other overload for the format. Parsing fails with std::errc::value_too_large if the array is too small.
+ * @param text The text to parse.
+ * @param delimiter The character separating the fields.
+ * @param values The array to write the values to.
+ * @param capacity The number of elements in the array.
+ * @return The number of values written, and the offset and kind of the first error if any.
+ */
+template<class T>
+ParseNumbersResult
+parse_numbers(const std::string_view text, const char delimiter, T* const values, const size_t capacity) {
+    size_t size = 0;
+    return detail::parse_numbers<T>(text, delimiter, [values, capacity, &size](const T value) {
+        if (size == capacity)
+            return false;
+        values[size++] = value;
+        return true;
+    });
+}
+
+}  // namespace rdk
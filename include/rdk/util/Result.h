@@ -5,7 +5,15 @@
 
 #pragma once
 
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace rdk {
 
@@ -92,4 +100,446 @@ inline Result error(const std::string& error_message) {
     return Result::error(error_message);
 }
 
+/**
+ * Compact error value: an error code plus an optional static message and an optional integer context (like an errno
+ * value or an offset). Creating, copying and returning an Error never allocates; text is only built by to_string().
+ * @tparam Code The type of the error code, typically an enum.
+ */
+template<class Code>
+class Error {
+  public:
+    /**
+     * @param code The error code.
+     * @param message A static message, which must outlive the error (typically a string literal). May be nullptr.
+     */
+    constexpr Error(const Code code, const char* message = nullptr) : code_(code), message_(message) {}
+
+    /**
+     * @param code The error code.
+     * @param message A static message, which must outlive the error (typically a string literal). May be nullptr.
+     * @param context A value giving context to the error, like an errno value or an offset.
+     */
+    constexpr Error(const Code code, const char* message, const int64_t context) :
+        code_(code), message_(message), context_(context), has_context_(true) {}
+
+    /**
+     * @return The error code.
+     */
+    [[nodiscard]] constexpr Code code() const {
+        return code_;
+    }
+
+    /**
+     * @return The message, which is empty if there is none.
+     */
+    [[nodiscard]] constexpr std::string_view message() const {
+        return message_ == nullptr ? std::string_view() : std::string_view(message_);
+    }
+
+    /**
+     * @return The context value, if any.
+     */
+    [[nodiscard]] constexpr std::optional<int64_t> context() const {
+        return has_context_ ? std::optional<int64_t>(context_) : std::nullopt;
+    }
+
+    /**
+     * Formats the error as text, like "Connection refused (111)". Allocates, so only call this when the text is needed.
+     * @return The message, or "Unknown Error" if there is none, followed by the context if there is any.
+     */
+    [[nodiscard]] std::string to_string() const {
+        std::string text(message_ == nullptr ? "Unknown Error" : message_);
+        if (has_context_) {
+            text += " (" + std::to_string(context_) + ")";
+        }
+        return text;
+    }
+
+    /**
+     * Errors are equal if their codes are equal, regardless of message and context.
+     */
+    friend constexpr bool operator==(const Error& lhs, const Error& rhs) {
+        return lhs.code_ == rhs.code_;
+    }
+
+    friend constexpr bool operator!=(const Error& lhs, const Error& rhs) {
+        return lhs.code_ != rhs.code_;
+    }
+
+  private:
+    Code code_;
+    const char* message_ {nullptr};
+    int64_t context_ {0};
+    bool has_context_ {false};
+};
+
+/**
+ * Wrapper marking a value as error, for constructing an Expected. Create using unexpected() or make_error().
+ */
+template<class E>
+struct Unexpected {
+    E error;
+};
+
+/**
+ * Tag for constructing an Expected holding an error in place.
+ */
+struct unexpect_t {
+    explicit unexpect_t() = default;
+};
+
+inline constexpr unexpect_t unexpect {};
+
+/**
+ * Marks given value as error, so that it can be returned from a function returning Expected.
+ * @param error The error.
+ * @return The wrapped error.
+ */
+template<class E>
+constexpr Unexpected<std::decay_t<E>> unexpected(E&& error) {
+    return {std::forward<E>(error)};
+}
+
+/**
+ * Creates an Error and marks it as error, so that it can be returned from a function returning Expected.
+ *
+ * Example:
+ *     rdk::Expected<size_t, rdk::Error<IoError>> read(Buffer& buffer) {
+ *         if (buffer.empty())
+ *             return rdk::make_error(IoError::kWouldBlock, "Would block");
+ *         return buffer.size();
+ *     }
+ *
+ * @param code The error code.
+ * @param message A static message, which must outlive the error. May be nullptr.
+ * @return The wrapped error.
+ */
+template<class Code>
+constexpr Unexpected<Error<Code>> make_error(const Code code, const char* message = nullptr) {
+    return {Error<Code>(code, message)};
+}
+
+template<class T, class E>
+class Expected;
+
+namespace detail {
+
+template<class T>
+struct IsExpected : std::false_type {};
+
+template<class T, class E>
+struct IsExpected<Expected<T, E>> : std::true_type {};
+
+}  // namespace detail
+
+/**
+ * Holds either a value or an error, as alternative to returning a Result plus an out parameter. Unlike Result, neither
+ * path allocates (unless T or E do): use a compact error type like Error<Code> or an enum. Modelled after C++23's
+ * std::expected, including the monadic and_then(), map() (transform) and or_else() operations.
+ *
+ * Example:
+ *     auto port = parse_port(text).map([](uint16_t port) { return port + 1; }).value_or(0);
+ *
+ * @tparam T The type of the value, which can be void.
+ * @tparam E The type of the error.
+ */
+template<class T, class E>
+class [[nodiscard]] Expected {
+  public:
+    using value_type = T;
+    using error_type = E;
+
+    template<class U>
+    using rebind = Expected<U, E>;
+
+    /**
+     * Constructs a value-initialized value.
+     */
+    constexpr Expected() : storage_(std::in_place_index<0>) {}
+
+    /**
+     * Constructs a value.
+     */
+    template<
+        class U = T,
+        std::enable_if_t<
+            std::is_constructible_v<T, U&&> && !std::is_same_v<std::decay_t<U>, Expected>
+                && !std::is_same_v<std::decay_t<U>, std::in_place_t> && !std::is_same_v<std::decay_t<U>, unexpect_t>,
+            int> = 0>
+    constexpr Expected(U&& value) : storage_(std::in_place_index<0>, std::forward<U>(value)) {}
+
+    /**
+     * Constructs an error.
+     */
+    template<class G>
+    constexpr Expected(Unexpected<G> error) : storage_(std::in_place_index<1>, std::move(error.error)) {}
+
+    template<class... Args>
+    constexpr explicit Expected(std::in_place_t, Args&&... args) :
+        storage_(std::in_place_index<0>, std::forward<Args>(args)...) {}
+
+    template<class... Args>
+    constexpr explicit Expected(unexpect_t, Args&&... args) :
+        storage_(std::in_place_index<1>, std::forward<Args>(args)...) {}
+
+    /**
+     * @return True if this holds a value.
+     */
+    [[nodiscard]] constexpr bool has_value() const noexcept {
+        return storage_.index() == 0;
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /**
+     * @return The value. Must only be called if this holds a value.
+     */
+    constexpr T& value() & {
+        assert(has_value());
+        return *std::get_if<0>(&storage_);
+    }
+
+    constexpr const T& value() const& {
+        assert(has_value());
+        return *std::get_if<0>(&storage_);
+    }
+
+    constexpr T&& value() && {
+        assert(has_value());
+        return std::move(*std::get_if<0>(&storage_));
+    }
+
+    constexpr T& operator*() & {
+        return value();
+    }
+
+    constexpr const T& operator*() const& {
+        return value();
+    }
+
+    constexpr T&& operator*() && {
+        return std::move(*this).value();
+    }
+
+    constexpr T* operator->() {
+        return &value();
+    }
+
+    constexpr const T* operator->() const {
+        return &value();
+    }
+
+    /**
+     * @return The error. Must only be called if this holds an error.
+     */
+    constexpr const E& error() const& {
+        assert(!has_value());
+        return *std::get_if<1>(&storage_);
+    }
+
+    constexpr E&& error() && {
+        assert(!has_value());
+        return std::move(*std::get_if<1>(&storage_));
+    }
+
+    /**
+     * @param default_value The value to return if this holds an error.
+     * @return The value, or given default value.
+     */
+    template<class U>
+    constexpr T value_or(U&& default_value) const& {
+        return has_value() ? value() : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    template<class U>
+    constexpr T value_or(U&& default_value) && {
+        return has_value() ? std::move(*this).value() : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    /**
+     * Calls given function with the value if there is one, otherwise propagates the error.
+     * @param f Function taking the value and returning an Expected with the same error type.
+     * @return The result of the function, or the error.
+     */
+    template<class F>
+    constexpr auto and_then(F&& f) const& {
+        using Returned = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, const T&>>>;
+        static_assert(detail::IsExpected<Returned>::value, "Function must return an Expected");
+        if (has_value())
+            return std::invoke(std::forward<F>(f), value());
+        return Returned(unexpect, error());
+    }
+
+    template<class F>
+    constexpr auto and_then(F&& f) && {
+        using Returned = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, T&&>>>;
+        static_assert(detail::IsExpected<Returned>::value, "Function must return an Expected");
+        if (has_value())
+            return std::invoke(std::forward<F>(f), std::move(*this).value());
+        return Returned(unexpect, std::move(*this).error());
+    }
+
+    /**
+     * Transforms the value with given function if there is one, otherwise propagates the error.
+     * @param f Function taking the value and returning a new value (or void).
+     * @return An Expected with the new value, or the error.
+     */
+    template<class F>
+    constexpr auto map(F&& f) const& {
+        using U = std::remove_cv_t<std::invoke_result_t<F, const T&>>;
+        if (!has_value())
+            return Expected<U, E>(unexpect, error());
+        if constexpr (std::is_void_v<U>) {
+            std::invoke(std::forward<F>(f), value());
+            return Expected<U, E>();
+        } else {
+            return Expected<U, E>(std::in_place, std::invoke(std::forward<F>(f), value()));
+        }
+    }
+
+    template<class F>
+    constexpr auto map(F&& f) && {
+        using U = std::remove_cv_t<std::invoke_result_t<F, T&&>>;
+        if (!has_value())
+            return Expected<U, E>(unexpect, std::move(*this).error());
+        if constexpr (std::is_void_v<U>) {
+            std::invoke(std::forward<F>(f), std::move(*this).value());
+            return Expected<U, E>();
+        } else {
+            return Expected<U, E>(std::in_place, std::invoke(std::forward<F>(f), std::move(*this).value()));
+        }
+    }
+
+    /**
+     * Calls given function with the error if there is one, for example to recover from it or to translate it.
+     * @param f Function taking the error and returning an Expected with the same value type.
+     * @return This if it holds a value, otherwise the result of the function.
+     */
+    template<class F>
+    constexpr auto or_else(F&& f) const& {
+        using Returned = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, const E&>>>;
+        static_assert(detail::IsExpected<Returned>::value, "Function must return an Expected");
+        if (has_value())
+            return Returned(std::in_place, value());
+        return std::invoke(std::forward<F>(f), error());
+    }
+
+    template<class F>
+    constexpr auto or_else(F&& f) && {
+        using Returned = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, E&&>>>;
+        static_assert(detail::IsExpected<Returned>::value, "Function must return an Expected");
+        if (has_value())
+            return Returned(std::in_place, std::move(*this).value());
+        return std::invoke(std::forward<F>(f), std::move(*this).error());
+    }
+
+  private:
+    std::variant<T, E> storage_;
+};
+
+/**
+ * Specialization of Expected for operations which don't return a value, only success or an error.
+ */
+template<class E>
+class [[nodiscard]] Expected<void, E> {
+  public:
+    using value_type = void;
+    using error_type = E;
+
+    template<class U>
+    using rebind = Expected<U, E>;
+
+    /**
+     * Constructs a success.
+     */
+    constexpr Expected() = default;
+
+    constexpr explicit Expected(std::in_place_t) {}
+
+    /**
+     * Constructs an error.
+     */
+    template<class G>
+    constexpr Expected(Unexpected<G> error) : error_(std::in_place, std::move(error.error)) {}
+
+    template<class... Args>
+    constexpr explicit Expected(unexpect_t, Args&&... args) : error_(std::in_place, std::forward<Args>(args)...) {}
+
+    [[nodiscard]] constexpr bool has_value() const noexcept {
+        return !error_.has_value();
+    }
+
+    constexpr explicit operator bool() const noexcept {
+        return has_value();
+    }
+
+    /**
+     * Does nothing, for symmetry with Expected<T, E>. Must only be called if this holds no error.
+     */
+    constexpr void value() const {
+        assert(has_value());
+    }
+
+    /**
+     * @return The error. Must only be called if this holds an error.
+     */
+    constexpr const E& error() const& {
+        assert(!has_value());
+        return *error_;
+    }
+
+    constexpr E&& error() && {
+        assert(!has_value());
+        return std::move(*error_);
+    }
+
+    /**
+     * Calls given function if this holds no error, otherwise propagates the error.
+     * @param f Function without arguments returning an Expected with the same error type.
+     */
+    template<class F>
+    constexpr auto and_then(F&& f) const {
+        using Returned = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F>>>;
+        static_assert(detail::IsExpected<Returned>::value, "Function must return an Expected");
+        if (has_value())
+            return std::invoke(std::forward<F>(f));
+        return Returned(unexpect, error());
+    }
+
+    /**
+     * Calls given function if this holds no error, and returns its result as value.
+     * @param f Function without arguments returning a value (or void).
+     */
+    template<class F>
+    constexpr auto map(F&& f) const {
+        using U = std::remove_cv_t<std::invoke_result_t<F>>;
+        if (!has_value())
+            return Expected<U, E>(unexpect, error());
+        if constexpr (std::is_void_v<U>) {
+            std::invoke(std::forward<F>(f));
+            return Expected<U, E>();
+        } else {
+            return Expected<U, E>(std::in_place, std::invoke(std::forward<F>(f)));
+        }
+    }
+
+    /**
+     * Calls given function with the error if there is one.
+     * @param f Function taking the error and returning an Expected<void, ...>.
+     */
+    template<class F>
+    constexpr auto or_else(F&& f) const {
+        using Returned = std::remove_cv_t<std::remove_reference_t<std::invoke_result_t<F, const E&>>>;
+        static_assert(detail::IsExpected<Returned>::value, "Function must return an Expected");
+        if (has_value())
+            return Returned();
+        return std::invoke(std::forward<F>(f), error());
+    }
+
+  private:
+    std::optional<E> error_;
+};
+
 }  // namespace rdk
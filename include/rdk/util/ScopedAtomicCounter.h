@@ -6,37 +6,74 @@
 #pragma once
 
 #include <atomic>
+#include <utility>
 
-template<class Type>
+/**
+ * Increments an atomic on construction and decrements it again on destruction, for example to keep track of the number
+ * of requests in flight. Copies increment the atomic again, moves transfer the responsibility to decrement it.
+ *
+ * @tparam Type The type of the atomic value.
+ * @tparam Order The memory order of the increments and decrements. Use std::memory_order_relaxed for counters which
+ * are only used as statistic, and don't guard other memory.
+ */
+template<class Type, std::memory_order Order = std::memory_order_seq_cst>
 class ScopedAtomicCounter {
   public:
+    explicit ScopedAtomicCounter(std::atomic<Type>& atomic) :
+        atomic_(&atomic), previous_value_(atomic.fetch_add(1, Order)) {}
+
     ScopedAtomicCounter(const ScopedAtomicCounter& other) : atomic_(other.atomic_) {
-        previous_value_ = atomic_.fetch_add(1);
+        if (atomic_ != nullptr) {
+            previous_value_ = atomic_->fetch_add(1, Order);
+        }
     }
 
-    ScopedAtomicCounter(ScopedAtomicCounter&& other) noexcept = delete;
-
-    explicit ScopedAtomicCounter(std::atomic<Type>& atomic) : atomic_(atomic) {
-        previous_value_ = atomic_.fetch_add(1);
-    }
+    ScopedAtomicCounter(ScopedAtomicCounter&& other) noexcept :
+        atomic_(std::exchange(other.atomic_, nullptr)), previous_value_(other.previous_value_) {}
 
+    /**
+     * Decrements the current atomic and increments the atomic of other.
+     */
     ScopedAtomicCounter& operator=(const ScopedAtomicCounter& other) {
-        atomic_ = other.atomic_;
-        previous_value_ = atomic_.fetch_add(1);
+        if (this != &other) {
+            *this = ScopedAtomicCounter(other);
+        }
         return *this;
     }
 
-    ScopedAtomicCounter& operator=(ScopedAtomicCounter&&) noexcept = delete;
+    /**
+     * Decrements the current atomic and takes over the atomic of other, without changing it.
+     */
+    ScopedAtomicCounter& operator=(ScopedAtomicCounter&& other) noexcept {
+        if (this != &other) {
+            reset();
+            atomic_ = std::exchange(other.atomic_, nullptr);
+            previous_value_ = other.previous_value_;
+        }
+        return *this;
+    }
 
     ~ScopedAtomicCounter() {
-        atomic_.fetch_add(-1);
+        reset();
+    }
+
+    /**
+     * Decrements the atomic, if not already done (or moved away).
+     */
+    void reset() {
+        if (atomic_ != nullptr) {
+            std::exchange(atomic_, nullptr)->fetch_sub(1, Order);
+        }
     }
 
+    /**
+     * @return The value of the atomic before it was incremented by this object.
+     */
     [[nodiscard]] Type previous_value() const {
         return previous_value_;
     }
 
   private:
-    std::atomic<Type>& atomic_;
+    std::atomic<Type>* atomic_ {nullptr};
     Type previous_value_ {};
 };
@@ -5,7 +5,12 @@
 
 #pragma once
 
-#include <functional>
+#include "InplaceFunction.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace rdk {
@@ -14,39 +19,59 @@ namespace rdk {
  * This class gathers one or more functions and executes those on destruction if no call to cancel was done before.
  * This class acts as alternative to the 'goto cleanup' paradigm from C, where we want to rollback previous changes if a
  * following change did not succeed. This class is also exception safe.
+ *
+ * Functions are executed in reverse order of adding them, so that later changes (which might depend on earlier ones)
+ * are rolled back first. The first N functions are stored inline, so the common case doesn't allocate at all.
+ * @tparam N The number of functions which can be stored without allocating.
  */
+template<size_t N = 4>
 class ScopedRollback {
   public:
+    using Function = InplaceFunction<void()>;
+
     ScopedRollback() = default;
 
     /**
      * Constructor.
      * @param initial_rollback_function Function to execute on rollback.
      */
-    explicit ScopedRollback(std::function<void()>&& initial_rollback_function) {
-        rollback_functions_.push_back(std::move(initial_rollback_function));
+    template<class F>
+    explicit ScopedRollback(F&& initial_rollback_function) {
+        add(std::forward<F>(initial_rollback_function));
     }
 
     /**
-     * Executes all functions left in the internal array.
+     * Executes all functions left in the internal array, last added first.
      */
     ~ScopedRollback() {
-        for (auto& func : rollback_functions_) {
-            if (func) {
-                func();
+        for (auto it = overflow_functions_.rbegin(); it != overflow_functions_.rend(); ++it) {
+            if (*it) {
+                (*it)();
+            }
+        }
+
+        for (auto i = std::min(num_functions_, N); i > 0; --i) {
+            if (inline_functions_[i - 1]) {
+                inline_functions_[i - 1]();
             }
         }
     }
 
-    ScopedRollback(const ScopedRollback&) = delete;
-    ScopedRollback& operator=(const ScopedRollback&) = delete;
+    RDK_DECLARE_NON_COPYABLE(ScopedRollback)
+    RDK_DECLARE_NON_MOVEABLE(ScopedRollback)
 
     /**
-     * Adds a function to rollback.
+     * Adds a function to rollback. Callables which don't fit in an InplaceFunction can be wrapped in a std::function.
      * @param function_to_rollback Function to rollback, if not committed.
      */
-    void add(std::function<void()>&& function_to_rollback) {
-        rollback_functions_.push_back(std::move(function_to_rollback));
+    template<class F>
+    void add(F&& function_to_rollback) {
+        if (num_functions_ < N) {
+            inline_functions_[num_functions_] = Function(std::forward<F>(function_to_rollback));
+        } else {
+            overflow_functions_.emplace_back(std::forward<F>(function_to_rollback));
+        }
+        num_functions_++;
     }
 
     /**
@@ -54,11 +79,24 @@ class ScopedRollback {
      * whenever all operations were successful and nothing need to be rolled back.
      */
     void cancel() {
-        rollback_functions_.clear();
+        for (size_t i = 0; i < std::min(num_functions_, N); ++i) {
+            inline_functions_[i].reset();
+        }
+        overflow_functions_.clear();
+        num_functions_ = 0;
+    }
+
+    /**
+     * @return The number of functions added since construction or the last call to cancel().
+     */
+    [[nodiscard]] size_t size() const {
+        return num_functions_;
     }
 
   private:
-    std::vector<std::function<void()>> rollback_functions_;
+    std::array<Function, N> inline_functions_;
+    std::vector<Function> overflow_functions_;
+    size_t num_functions_ {0};
 };
 
 }  // namespace rdk
@@ -0,0 +1,211 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace rdk {
+
+namespace detail {
+
+/**
+ * @return A small number identifying the calling thread, handed out round-robin in the order threads first ask for it.
+ */
+inline size_t sharded_counter_thread_index() {
+    static std::atomic<size_t> next_index {0};
+    static thread_local const size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+}  // namespace detail
+
+/**
+ * Counter which can be changed from many threads at once without contending on a single cache line, for example to
+ * track the number of requests in flight.
+ *
+ * Every thread is assigned one of the shards, each on its own cache line. Changes are added to the shard of the
+ * calling thread, and once a shard accumulated a batch worth of changes it is flushed into the global value. This
+ * makes two kinds of reads possible:
+ * - load_approximate() only reads the global value, which is cheap but may be off by up to the number of shards
+ *   times the batch size.
+ * - load() adds up the global value and all shards. The result is exact when no changes happen during the call.
+ *
+ * The counter doesn't order other memory operations, use it for statistics and bookkeeping only.
+ *
+ * @tparam Type The signed integral type of the value.
+ */
+template<class Type>
+class ShardedCounter {
+  public:
+    static_assert(std::is_integral_v<Type> && std::is_signed_v<Type>, "Type must be a signed integral type");
+
+    /**
+     * Constructs a counter with a shard for every hardware thread.
+     * @param batch_size The number of changes a shard accumulates before flushing them into the global value.
+     */
+    explicit ShardedCounter(const Type batch_size = 32) :
+        ShardedCounter(std::thread::hardware_concurrency(), batch_size) {}
+
+    /**
+     * Constructs a counter.
+     * @param min_shards The minimum number of shards, which is rounded up to a power of two.
+     * @param batch_size The number of changes a shard accumulates before flushing them into the global value.
+     */
+    ShardedCounter(const size_t min_shards, const Type batch_size) :
+        shard_count_(round_up_to_power_of_two(min_shards)),
+        batch_size_(batch_size < 1 ? 1 : batch_size),
+        shards_(std::make_unique<Shard[]>(shard_count_)) {}
+
+    RDK_DECLARE_NON_COPYABLE(ShardedCounter)
+    RDK_DECLARE_NON_MOVEABLE(ShardedCounter)
+
+    /**
+     * Adds to the counter.
+     * @param delta The value to add, which may be negative.
+     */
+    void add(const Type delta) {
+        add(shard_index(), delta);
+    }
+
+    void increment() {
+        add(1);
+    }
+
+    void decrement() {
+        add(-1);
+    }
+
+    /**
+     * @return The exact value of the counter, as long as no changes happen during the call.
+     */
+    [[nodiscard]] Type load() const {
+        auto value = global_.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < shard_count_; ++i) {
+            value += shards_[i].value.load(std::memory_order_relaxed);
+        }
+        return value;
+    }
+
+    /**
+     * @return The value of the counter, without the changes which are not yet flushed from the shards.
+     */
+    [[nodiscard]] Type load_approximate() const {
+        return global_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @return The number of shards.
+     */
+    [[nodiscard]] size_t shard_count() const {
+        return shard_count_;
+    }
+
+  private:
+    template<class>
+    friend class ScopedShardedCounter;
+
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<Type> value {0};
+    };
+
+    alignas(kCacheLineSize) std::atomic<Type> global_ {0};
+    alignas(kCacheLineSize) const size_t shard_count_;
+    const Type batch_size_;
+    std::unique_ptr<Shard[]> shards_;
+
+    static size_t round_up_to_power_of_two(const size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result *= 2;
+        }
+        return result;
+    }
+
+    [[nodiscard]] size_t shard_index() const {
+        return detail::sharded_counter_thread_index() & (shard_count_ - 1);
+    }
+
+    void add(const size_t index, const Type delta) {
+        auto& shard = shards_[index].value;
+        const auto value = shard.fetch_add(delta, std::memory_order_relaxed) + delta;
+        if (value >= batch_size_ || value <= -batch_size_) {
+            // Threads sharing this shard might flush concurrently, which is fine because the same amount is moved.
+            shard.fetch_sub(value, std::memory_order_relaxed);
+            global_.fetch_add(value, std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ * Increments a ShardedCounter on construction and decrements it on destruction, like ScopedAtomicCounter. Both
+ * changes go to the same shard, even when the object is destroyed on another thread, so they usually cancel out
+ * without ever touching the global value.
+ *
+ * @tparam Type The type of the counter value.
+ */
+template<class Type>
+class ScopedShardedCounter {
+  public:
+    explicit ScopedShardedCounter(ShardedCounter<Type>& counter) :
+        counter_(&counter), shard_index_(counter.shard_index()) {
+        counter_->add(shard_index_, 1);
+    }
+
+    ScopedShardedCounter(const ScopedShardedCounter& other) : counter_(other.counter_) {
+        if (counter_ != nullptr) {
+            shard_index_ = counter_->shard_index();
+            counter_->add(shard_index_, 1);
+        }
+    }
+
+    ScopedShardedCounter(ScopedShardedCounter&& other) noexcept :
+        counter_(std::exchange(other.counter_, nullptr)), shard_index_(other.shard_index_) {}
+
+    ScopedShardedCounter& operator=(const ScopedShardedCounter& other) {
+        if (this != &other) {
+            *this = ScopedShardedCounter(other);
+        }
+        return *this;
+    }
+
+    ScopedShardedCounter& operator=(ScopedShardedCounter&& other) noexcept {
+        if (this != &other) {
+            reset();
+            counter_ = std::exchange(other.counter_, nullptr);
+            shard_index_ = other.shard_index_;
+        }
+        return *this;
+    }
+
+    ~ScopedShardedCounter() {
+        reset();
+    }
+
+    /**
+     * Decrements the counter, if not already done.
+     */
+    void reset() {
+        if (counter_ != nullptr) {
+            std::exchange(counter_, nullptr)->add(shard_index_, -1);
+        }
+    }
+
+  private:
+    ShardedCounter<Type>* counter_ {nullptr};
+    size_t shard_index_ {0};
+};
+
+}  // namespace rdk
@@ -0,0 +1,137 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rdk {
+
+/**
+ * Bounded, wait-free single producer single consumer queue. Elements are stored inline in a ring buffer, so pushing and
+ * popping never allocate, lock or make system calls, which makes it suitable for passing data from and to realtime
+ * threads. Exactly one thread may push and exactly one (other) thread may pop at a time.
+ * @tparam T The element type.
+ * @tparam Capacity The maximum number of elements in the queue, must be a power of two.
+ */
+template<class T, size_t Capacity>
+class SpscQueue {
+  public:
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_nothrow_destructible_v<T>, "T must be nothrow destructible");
+
+    SpscQueue() = default;
+
+    ~SpscQueue() {
+        while (consume([](T&) {})) {}
+    }
+
+    RDK_DECLARE_NON_COPYABLE(SpscQueue)
+    RDK_DECLARE_NON_MOVEABLE(SpscQueue)
+
+    /**
+     * Constructs an element at the back of the queue. Must only be called from the producer thread.
+     * @param args The arguments to construct the element with.
+     * @return True if the element was added, or false if the queue was full.
+     */
+    template<class... Args>
+    bool emplace(Args&&... args) {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+
+        if (tail - cached_head_ == Capacity) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ == Capacity)
+                return false;
+        }
+
+        ::new (static_cast<void*>(slot(tail))) T(std::forward<Args>(args)...);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Adds an element to the back of the queue. Must only be called from the producer thread.
+     * @param value The element to add.
+     * @return True if the element was added, or false if the queue was full.
+     */
+    bool push(const T& value) {
+        return emplace(value);
+    }
+
+    /**
+     * Removes the element at the front of the queue. Must only be called from the consumer thread.
+     * @param value Receives the removed element.
+     * @return True if an element was removed, or false if the queue was empty.
+     */
+    bool pop(T& value) {
+        return consume([&value](T& element) {
+            value = std::move(element);
+        });
+    }
+
+    /**
+     * Calls given function with the element at the front of the queue, and removes it afterwards. This avoids moving
+     * the element out of the queue. Must only be called from the consumer thread.
+     * @param f The function to call, with signature void(T&).
+     * @return True if an element was consumed, or false if the queue was empty.
+     */
+    template<class F>
+    bool consume(F&& f) {
+        const auto head = head_.load(std::memory_order_relaxed);
+
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_)
+                return false;
+        }
+
+        auto* element = std::launder(reinterpret_cast<T*>(slot(head)));
+        f(*element);
+        element->~T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @return The number of elements in the queue. The value is approximate when called while the other thread is
+     * pushing or popping.
+     */
+    [[nodiscard]] size_t size_approx() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @return The maximum number of elements the queue can hold.
+     */
+    static constexpr size_t capacity() {
+        return Capacity;
+    }
+
+  private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    // Consumer side.
+    alignas(kCacheLineSize) std::atomic<size_t> head_ {0};
+    size_t cached_tail_ {0};
+
+    // Producer side.
+    alignas(kCacheLineSize) std::atomic<size_t> tail_ {0};
+    size_t cached_head_ {0};
+
+    alignas(kCacheLineSize) alignas(T) std::byte storage_[sizeof(T) * Capacity];
+
+    std::byte* slot(const size_t index) {
+        return storage_ + sizeof(T) * (index & (Capacity - 1));
+    }
+};
+
+}  // namespace rdk
@@ -0,0 +1,289 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "Hash.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string_view>
+#include <vector>
+
+namespace rdk {
+
+class StringPool;
+
+namespace detail {
+
+/**
+ * Header of a string stored in a StringPool. The characters follow the header directly, and are null terminated.
+ */
+struct InternedStringHeader {
+    size_t hash;
+    size_t size;
+
+    [[nodiscard]] const char* data() const {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Handle to a string stored in a StringPool. An InternedString is the size of a pointer and is cheap to copy. Because
+ * the pool stores each unique string once, two handles from the same pool are equal if and only if they point to the
+ * same string, which makes comparing them O(1). The hash is computed once when interning.
+ *
+ * A default constructed InternedString is the empty string, which is also what interning an empty string returns.
+ * Handles stay valid for as long as the pool which created them. Handles from different pools must not be compared.
+ */
+class InternedString {
+  public:
+    InternedString() = default;
+
+    /**
+     * @return The string. The view stays valid for as long as the pool exists.
+     */
+    [[nodiscard]] std::string_view view() const {
+        return header_ == nullptr ? std::string_view() : std::string_view(header_->data(), header_->size);
+    }
+
+    /**
+     * @return A pointer to the null terminated string.
+     */
+    [[nodiscard]] const char* c_str() const {
+        return header_ == nullptr ? "" : header_->data();
+    }
+
+    /**
+     * @return The length of the string.
+     */
+    [[nodiscard]] size_t size() const {
+        return header_ == nullptr ? 0 : header_->size;
+    }
+
+    /**
+     * @return True if this is the empty string.
+     */
+    [[nodiscard]] bool empty() const {
+        return header_ == nullptr;
+    }
+
+    /**
+     * @return The hash of the string (equal to StringHash), which was computed when the string was interned.
+     */
+    [[nodiscard]] size_t hash() const {
+        return header_ == nullptr ? kEmptyHash : header_->hash;
+    }
+
+    operator std::string_view() const {
+        return view();
+    }
+
+    friend bool operator==(const InternedString lhs, const InternedString rhs) {
+        return lhs.header_ == rhs.header_;
+    }
+
+    friend bool operator!=(const InternedString lhs, const InternedString rhs) {
+        return lhs.header_ != rhs.header_;
+    }
+
+  private:
+    friend class StringPool;
+
+    static inline const size_t kEmptyHash = StringHash()({});
+
+    const detail::InternedStringHeader* header_ {nullptr};
+
+    explicit InternedString(const detail::InternedStringHeader* header) : header_(header) {}
+};
+
+/**
+ * Stores unique strings and hands out InternedString handles to them.
+ *
+ * The strings are stored in arena chunks which are never moved or freed before the pool is destroyed, so handles and
+ * views stay valid. The strings are indexed by an open addressing hash table. Looking up a string which has already
+ * been interned (which is the common case) doesn't lock: readers probe the table using atomic loads, while adding a
+ * string happens under a mutex. When the table grows, the old table is kept alive until the pool is destroyed, so
+ * readers which are still probing it don't need to be tracked.
+ *
+ * All functions are thread safe.
+ */
+class StringPool {
+  public:
+    StringPool() {
+        tables_.push_back(std::make_unique<Table>(kInitialCapacity));
+        table_.store(tables_.back().get(), std::memory_order_release);
+    }
+
+    RDK_DECLARE_NON_COPYABLE(StringPool)
+    RDK_DECLARE_NON_MOVEABLE(StringPool)
+
+    /**
+     * Interns a string, storing a copy in the pool if it isn't already there.
+     * @param str The string to intern.
+     * @return The handle to the string in the pool.
+     */
+    InternedString intern(const std::string_view str) {
+        if (str.empty())
+            return {};
+
+        const auto hash = StringHash()(str);
+        if (const auto* header = find_in(*table_.load(std::memory_order_acquire), str, hash))
+            return InternedString(header);
+
+        std::lock_guard lock(mutex_);
+
+        // Search again, the string might have been added since the lookup above.
+        auto* table = table_.load(std::memory_order_relaxed);
+        if (const auto* header = find_in(*table, str, hash))
+            return InternedString(header);
+
+        if ((size_ + 1) * 2 > table->capacity) {
+            table = grow(*table);
+        }
+
+        const auto* header = allocate(str, hash);
+        table->slots[probe(*table, hash)].store(header, std::memory_order_release);
+        size_++;
+        return InternedString(header);
+    }
+
+    /**
+     * Looks up a string without adding it.
+     * @param str The string to look up.
+     * @return The handle to the string, or an empty handle if the string is not in the pool.
+     */
+    [[nodiscard]] InternedString find(const std::string_view str) const {
+        if (str.empty())
+            return {};
+
+        const auto hash = StringHash()(str);
+        if (const auto* header = find_in(*table_.load(std::memory_order_acquire), str, hash))
+            return InternedString(header);
+
+        // The string might just have been added to a new table, which the current table doesn't know about.
+        std::lock_guard lock(mutex_);
+        return InternedString(find_in(*table_.load(std::memory_order_relaxed), str, hash));
+    }
+
+    /**
+     * @return The number of unique (non-empty) strings in the pool.
+     */
+    [[nodiscard]] size_t size() const {
+        std::lock_guard lock(mutex_);
+        return size_;
+    }
+
+  private:
+    using Header = detail::InternedStringHeader;
+
+    static constexpr size_t kInitialCapacity = 64;  // Must be a power of two.
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    struct Table {
+        explicit Table(const size_t capacity_) :
+            capacity(capacity_), slots(std::make_unique<std::atomic<const Header*>[]>(capacity_)) {}
+
+        const size_t capacity;
+        std::unique_ptr<std::atomic<const Header*>[]> slots;
+    };
+
+    struct Chunk {
+        std::unique_ptr<char[]> memory;
+        size_t size {0};
+        size_t used {0};
+    };
+
+    mutable std::mutex mutex_;
+    std::atomic<Table*> table_ {nullptr};
+    std::vector<std::unique_ptr<Table>> tables_;  // The current table and all previous tables.
+    std::vector<Chunk> chunks_;
+    size_t size_ {0};
+
+    static const Header* find_in(const Table& table, const std::string_view str, const size_t hash) {
+        const auto mask = table.capacity - 1;
+        for (auto i = hash & mask;; i = (i + 1) & mask) {
+            const auto* header = table.slots[i].load(std::memory_order_acquire);
+            if (header == nullptr)
+                return nullptr;
+            if (header->hash == hash && header->size == str.size()
+                && std::memcmp(header->data(), str.data(), str.size()) == 0)
+                return header;
+        }
+    }
+
+    /**
+     * @return The index of the first free slot for given hash.
+     */
+    static size_t probe(const Table& table, const size_t hash) {
+        const auto mask = table.capacity - 1;
+        auto i = hash & mask;
+        while (table.slots[i].load(std::memory_order_relaxed) != nullptr) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    Table* grow(const Table& table) {
+        auto new_table = std::make_unique<Table>(table.capacity * 2);
+        for (size_t i = 0; i < table.capacity; ++i) {
+            if (const auto* header = table.slots[i].load(std::memory_order_relaxed)) {
+                new_table->slots[probe(*new_table, header->hash)].store(header, std::memory_order_relaxed);
+            }
+        }
+
+        tables_.push_back(std::move(new_table));
+        table_.store(tables_.back().get(), std::memory_order_release);
+        return tables_.back().get();
+    }
+
+    const Header* allocate(const std::string_view str, const size_t hash) {
+        const auto needed = (sizeof(Header) + str.size() + 1 + alignof(Header) - 1) & ~(alignof(Header) - 1);
+
+        if (chunks_.empty() || chunks_.back().size - chunks_.back().used < needed) {
+            // Strings which are larger than a chunk get a chunk of their own.
+            Chunk chunk;
+            chunk.size = std::max(kChunkSize, needed);
+            chunk.memory = std::make_unique<char[]>(chunk.size);
+            chunks_.push_back(std::move(chunk));
+        }
+
+        auto& chunk = chunks_.back();
+        auto* memory = chunk.memory.get() + chunk.used;
+        chunk.used += needed;
+
+        auto* header = ::new (static_cast<void*>(memory)) Header {hash, str.size()};
+        auto* data = memory + sizeof(Header);
+        std::memcpy(data, str.data(), str.size());
+        data[str.size()] = '\0';
+        return header;
+    }
+};
+
+}  // namespace rdk
+
+namespace std {
+
+/**
+ * Returns the precomputed hash, so InternedString can be used as key in unordered containers.
+ */
+template<>
+struct hash<rdk::InternedString> {
+    size_t operator()(const rdk::InternedString str) const noexcept {
+        return str.hash();
+    }
+};
+
+}  // namespace std
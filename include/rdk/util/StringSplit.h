@@ -0,0 +1,239 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "StringUtilities.h"
+#include "rdk/detail/StringSearch.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace rdk {
+
+/**
+ * Options for split(), which can be combined using the | operator.
+ */
+enum class SplitOptions : uint8_t {
+    kNone = 0,
+    kSkipEmpty = 1 << 0,  // Don't yield empty tokens (after trimming, if enabled).
+    kTrim = 1 << 1,       // Remove leading and trailing ASCII whitespace from each token.
+};
+
+constexpr SplitOptions operator|(const SplitOptions lhs, const SplitOptions rhs) {
+    return static_cast<SplitOptions>(static_cast<uint8_t>(lhs) | static_cast<uint8_t>(rhs));
+}
+
+constexpr bool has_option(const SplitOptions options, const SplitOptions option) {
+    return (static_cast<uint8_t>(options) & static_cast<uint8_t>(option)) != 0;
+}
+
+/**
+ * Delimiter which matches any of a set of characters. Create using any_of().
+ */
+class AnyOf {
+  public:
+    constexpr explicit AnyOf(const std::string_view characters) {
+        for (const auto c : characters) {
+            const auto index = static_cast<unsigned char>(c);
+            table_[index / 64] |= uint64_t {1} << (index % 64);
+        }
+    }
+
+    /**
+     * @param c The character to test.
+     * @return True if given character is part of the set.
+     */
+    [[nodiscard]] constexpr bool contains(const char c) const {
+        const auto index = static_cast<unsigned char>(c);
+        return (table_[index / 64] >> (index % 64) & 1) != 0;
+    }
+
+  private:
+    std::array<uint64_t, 4> table_ {};
+};
+
+/**
+ * Creates a delimiter for split() which matches any of given characters.
+ * @param characters The characters to split on.
+ * @return The delimiter.
+ */
+constexpr AnyOf any_of(const std::string_view characters) {
+    return AnyOf(characters);
+}
+
+namespace detail {
+
+/**
+ * Finds the next delimiter in a text, returning its position and length.
+ */
+inline std::pair<size_t, size_t> find_delimiter(const std::string_view text, const size_t pos, const char delimiter) {
+    return {text.find(delimiter, pos), 1};
+}
+
+inline std::pair<size_t, size_t>
+find_delimiter(const std::string_view text, const size_t pos, const std::string_view delimiter) {
+    // An empty delimiter never matches, otherwise it would match at every position without making progress.
+    if (delimiter.empty())
+        return {std::string_view::npos, 0};
+
+    const auto found = rdk::detail::find(text.substr(pos), delimiter);
+    return {found == std::string_view::npos ? found : pos + found, delimiter.size()};
+}
+
+inline std::pair<size_t, size_t> find_delimiter(const std::string_view text, size_t pos, const AnyOf& delimiter) {
+    for (; pos < text.size(); ++pos) {
+        if (delimiter.contains(text[pos]))
+            return {pos, 1};
+    }
+    return {std::string_view::npos, 1};
+}
+
+}  // namespace detail
+
+/**
+ * Lazy range over the tokens of a text, as returned by split(). Tokens are found one at a time while iterating, in a
+ * single forward pass, and without allocating. The tokens point into the text, which must outlive the range.
+ * @tparam Delimiter The type of delimiter: char, std::string_view or AnyOf.
+ */
+template<class Delimiter>
+class SplitRange {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = const std::string_view&;
+
+        iterator() = default;
+
+        reference operator*() const {
+            return token_;
+        }
+
+        pointer operator->() const {
+            return &token_;
+        }
+
+        iterator& operator++() {
+            advance();
+            return *this;
+        }
+
+        iterator operator++(int) {
+            auto previous = *this;
+            advance();
+            return previous;
+        }
+
+        friend bool operator==(const iterator& lhs, const iterator& rhs) {
+            return lhs.range_ == rhs.range_ && lhs.next_ == rhs.next_ && lhs.at_end_ == rhs.at_end_;
+        }
+
+        friend bool operator!=(const iterator& lhs, const iterator& rhs) {
+            return !(lhs == rhs);
+        }
+
+      private:
+        friend class SplitRange;
+
+        const SplitRange* range_ {nullptr};
+        std::string_view token_;
+        size_t next_ {0};  // Start of the next token, or npos if the last token was reached.
+        bool at_end_ {true};
+
+        explicit iterator(const SplitRange* range) : range_(range), at_end_(false) {
+            advance();
+        }
+
+        void advance() {
+            const auto text = range_->text_;
+
+            while (true) {
+                if (next_ == std::string_view::npos) {
+                    at_end_ = true;
+                    next_ = 0;
+                    token_ = {};
+                    return;
+                }
+
+                const auto [pos, length] = detail::find_delimiter(text, next_, range_->delimiter_);
+                if (pos == std::string_view::npos) {
+                    token_ = text.substr(next_);
+                    next_ = std::string_view::npos;
+                } else {
+                    token_ = text.substr(next_, pos - next_);
+                    next_ = pos + length;
+                }
+
+                if (has_option(range_->options_, SplitOptions::kTrim)) {
+                    token_ = trim(token_);
+                }
+
+                if (!token_.empty() || !has_option(range_->options_, SplitOptions::kSkipEmpty))
+                    return;
+            }
+        }
+    };
+
+    SplitRange(const std::string_view text, Delimiter delimiter, const SplitOptions options) :
+        text_(text), delimiter_(std::move(delimiter)), options_(options) {}
+
+    /**
+     * @return An iterator to the first token. Must not be used after this range is destroyed.
+     */
+    [[nodiscard]] iterator begin() const {
+        return iterator(this);
+    }
+
+    /**
+     * @return The end iterator.
+     */
+    [[nodiscard]] iterator end() const {
+        iterator it;
+        it.range_ = this;
+        return it;
+    }
+
+  private:
+    std::string_view text_;
+    Delimiter delimiter_;
+    SplitOptions options_;
+};
+
+/**
+ * Splits a text into tokens separated by a delimiter, lazily. Splitting an empty text yields a single empty token
+ * (unless empty tokens are skipped), and a delimiter at the end yields an empty last token.
+ *
+ * Example, parsing a line of numbers in a single pass:
+ *     for (const auto field : rdk::split(line, ',', rdk::SplitOptions::kTrim)) {
+ *         if (auto value = rdk::from_string_strict<int>(field)) { ... }
+ *     }
+ *
+ * @param text The text to split, which must outlive the returned range.
+ * @param delimiter The delimiter: a character, a string, or a set of characters created with any_of().
+ * @param options Options for skipping empty tokens and trimming whitespace.
+ * @return A range of std::string_view tokens.
+ */
+inline SplitRange<char> split(const std::string_view text, const char delimiter, const SplitOptions options = {}) {
+    return {text, delimiter, options};
+}
+
+inline SplitRange<std::string_view>
+split(const std::string_view text, const std::string_view delimiter, const SplitOptions options = {}) {
+    return {text, delimiter, options};
+}
+
+inline SplitRange<AnyOf> split(const std::string_view text, const AnyOf& delimiter, const SplitOptions options = {}) {
+    return {text, delimiter, options};
+}
+
+}  // namespace rdk
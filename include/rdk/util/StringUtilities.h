@@ -5,27 +5,40 @@
 
 #pragma once
 
+#include "rdk/detail/CaseFolding.h"
+#include "rdk/detail/StringSearch.h"
+
 #include <charconv>
 #include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <vector>
 #include <algorithm>
 
-extern "C" {
-#include "natsort/strnatcmp.h"
-}
-
 namespace rdk {
 
 /**
  * Tests whether given text starts with a certain string.
  * @param text The text to test.
- * @param start
- * @return
+ * @param start The string to look for at the start of the text.
+ * @return True if the text starts with given string.
+ */
+constexpr bool starts_with(const std::string_view text, const std::string_view start) {
+    return text.size() >= start.size() && text.compare(0, start.size(), start) == 0;
+}
+
+/**
+ * Tests whether given text ends with a certain string.
+ * @param text The text to test.
+ * @param end The string to look for at the end of the text.
+ * @return True if the text ends with given string.
  */
-inline bool starts_with(const std::string_view text, const std::string_view start) {
-    return text.rfind(start, 0) == 0;
+constexpr bool ends_with(const std::string_view text, const std::string_view end) {
+    return text.size() >= end.size() && text.compare(text.size() - end.size(), end.size(), end) == 0;
 }
 
 /**
@@ -36,12 +49,12 @@ inline bool starts_with(const std::string_view text, const std::string_view star
  * not.
  * @return The truncated string, or an empty string when no needle was found.
  */
-inline std::string_view up_to_first_occurrence_of(
+constexpr std::string_view up_to_first_occurrence_of(
     std::string_view string_to_search_in,
     const std::string_view string_to_search_for,
     const bool include_sub_string_in_result
 ) {
-    const auto pos = string_to_search_in.find(string_to_search_for);
+    const auto pos = detail::find(string_to_search_in, string_to_search_for);
 
     if (pos == std::string_view::npos)
         return {};
@@ -58,21 +71,14 @@ inline std::string_view up_to_first_occurrence_of(
  * not.
  * @return The truncated string, or an empty string when no needle was found.
  */
-inline std::string_view up_to_the_nth_occurrence_of(
+constexpr std::string_view up_to_the_nth_occurrence_of(
     const size_t nth,
     std::string_view string_to_search_in,
     const std::string_view string_to_search_for,
     const bool include_sub_string_in_result
 ) {
-    size_t pos = std::string_view::npos;
-
-    for (size_t i = 0; i < nth; ++i) {
-        pos = string_to_search_in.find(string_to_search_for, pos + 1);
-
-        if (pos == std::string_view::npos) {
-            return {};
-        }
-    }
+    // Occurrences may overlap, and 0 never finds anything.
+    const auto pos = detail::find_nth(string_to_search_in, string_to_search_for, nth);
 
     if (pos == std::string_view::npos) {
         return {};
@@ -89,7 +95,7 @@ inline std::string_view up_to_the_nth_occurrence_of(
  * not.
  * @return The truncated string, or an empty string when no needle was found.
  */
-inline std::string_view up_to_last_occurrence_of(
+constexpr std::string_view up_to_last_occurrence_of(
     const std::string_view string_to_search_in,
     const std::string_view string_to_search_for,
     const bool include_sub_string_in_result
@@ -110,12 +116,12 @@ inline std::string_view up_to_last_occurrence_of(
  * not.
  * @return The truncated string, or an empty string when no needle was found.
  */
-inline std::string_view from_first_occurrence_of(
+constexpr std::string_view from_first_occurrence_of(
     std::string_view string_to_search_in,
     const std::string_view string_to_search_for,
     const bool include_sub_string_in_result
 ) {
-    const auto pos = string_to_search_in.find(string_to_search_for);
+    const auto pos = detail::find(string_to_search_in, string_to_search_for);
 
     if (pos == std::string_view::npos)
         return {};
@@ -131,21 +137,14 @@ inline std::string_view from_first_occurrence_of(
  * @param includeSubStringInResult If true the needle will be included in the resulting string, when false it will not.
  * @return The truncated string, or an empty string when no needle was found.
  */
-inline std::string_view from_nth_occurrence_of(
+constexpr std::string_view from_nth_occurrence_of(
     const size_t nth,
     std::string_view string_to_search_in,
     const std::string_view string_to_search_for,
     const bool includeSubStringInResult
 ) {
-    size_t pos = std::string_view::npos;
-
-    for (size_t i = 0; i < nth; ++i) {
-        pos = string_to_search_in.find(string_to_search_for, pos + 1);
-
-        if (pos == std::string_view::npos) {
-            return {};
-        }
-    }
+    // Occurrences may overlap, and 0 never finds anything.
+    const auto pos = detail::find_nth(string_to_search_in, string_to_search_for, nth);
 
     if (pos == std::string_view::npos) {
         return {};
@@ -164,7 +163,7 @@ inline std::string_view from_nth_occurrence_of(
  * @param includeSubStringInResult If true the needle will be included in the resulting string, when false it will not.
  * @return The truncated string, or an empty string when no needle was found.
  */
-inline std::string_view from_last_occurrence_of(
+constexpr std::string_view from_last_occurrence_of(
     const std::string_view string_to_search_in,
     const std::string_view string_to_search_for,
     const bool includeSubStringInResult
@@ -184,13 +183,11 @@ inline std::string_view from_last_occurrence_of(
  * @param prefix_to_remove Prefix to find and remove.
  * @return True if prefix was removed, or false if prefix was not found and string was not altered.
  */
-inline bool remove_prefix(std::string_view& string, const std::string_view prefix_to_remove) {
-    const auto pos = string.find(prefix_to_remove);
-
-    if (pos != 0)  // If prefix doesn't start at the beginning.
+constexpr bool remove_prefix(std::string_view& string, const std::string_view prefix_to_remove) {
+    if (!starts_with(string, prefix_to_remove))
         return false;
 
-    string = string.substr(pos + prefix_to_remove.size());
+    string.remove_prefix(prefix_to_remove.size());
     return true;
 }
 
@@ -200,15 +197,11 @@ inline bool remove_prefix(std::string_view& string, const std::string_view prefi
  * @param suffix_to_remove Suffix to find and remove.
  * @return True if suffix was removed, or false if suffix was not found and string was not altered.
  */
-inline bool remove_suffix(std::string_view& string, const std::string_view suffix_to_remove) {
-    const auto pos = string.rfind(suffix_to_remove);
-
-    if (pos != string.size() - suffix_to_remove.size()) {
+constexpr bool remove_suffix(std::string_view& string, const std::string_view suffix_to_remove) {
+    if (!ends_with(string, suffix_to_remove))
         return false;
-    }
-
-    string = string.substr(0, pos);
 
+    string.remove_suffix(suffix_to_remove.size());
     return true;
 }
 
@@ -249,8 +242,8 @@ std::optional<Type> from_string_strict(std::string_view string) {
  * @param c Character to find.
  * @return True if character was found, of false if character was not found.
  */
-inline bool string_contains(const std::string_view string, char c) {
-    return std::any_of(string.begin(), string.end(), [c](const char& item) { return item == c; });
+constexpr bool string_contains(const std::string_view string, const char c) {
+    return string.find(c) != std::string_view::npos;
 }
 
 /**
@@ -263,83 +256,453 @@ inline bool string_contains(const std::string_view string, char c) {
 }
 
 /**
- * Compares 2 string while taking numbers into account.
+ * Locale independent alternative to std::isdigit.
+ * @param c The character to test.
+ * @return True if given character is one of the ASCII digits.
+ */
+constexpr bool is_ascii_digit(const char c) {
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Locale independent alternative to std::isspace.
+ * @param c The character to test.
+ * @return True if given character is an ASCII whitespace character (space, \t, \n, \v, \f or \r).
+ */
+constexpr bool is_ascii_space(const char c) {
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+/**
+ * Locale independent alternative to std::toupper.
+ * @param c The character to convert.
+ * @return The uppercase version of given character if it is an ASCII lowercase letter, otherwise the character itself.
+ */
+constexpr char to_ascii_upper(const char c) {
+    return c >= 'a' && c <= 'z' ? static_cast<char>(c - ('a' - 'A')) : c;
+}
+
+/**
+ * Locale independent alternative to std::tolower.
+ * @param c The character to convert.
+ * @return The lowercase version of given character if it is an ASCII uppercase letter, otherwise the character itself.
+ */
+constexpr char to_ascii_lower(const char c) {
+    return detail::to_ascii_lower(c);
+}
+
+/**
+ * Compares two strings ignoring ASCII case. Other characters (including UTF-8 sequences) must match exactly. At runtime
+ * the characters are folded 16 or 32 at a time using SSE2 or AVX2.
+ * @param lhs The first string.
+ * @param rhs The second string.
+ * @return True if the strings are equal ignoring case.
+ */
+constexpr bool iequals(const std::string_view lhs, const std::string_view rhs) {
+    if (lhs.size() != rhs.size())
+        return false;
+
+    if (!detail::is_constant_evaluated())
+        return detail::iequals_runtime(lhs.data(), rhs.data(), lhs.size(), detail::simd_level());
+
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (to_ascii_lower(lhs[i]) != to_ascii_lower(rhs[i]))
+            return false;
+    }
+    return true;
+}
+
+/**
+ * Tests whether given text starts with a certain string, ignoring ASCII case.
+ * @param text The text to test.
+ * @param start The string to look for at the start of the text.
+ * @return True if the text starts with given string.
+ */
+constexpr bool istarts_with(const std::string_view text, const std::string_view start) {
+    return text.size() >= start.size() && iequals(text.substr(0, start.size()), start);
+}
+
+/**
+ * Finds the first occurrence of a needle ignoring ASCII case. At runtime a SIMD search (SSE2 or AVX2) is used.
+ * @param haystack The string to search in.
+ * @param needle The string to search for.
+ * @return The position of the occurrence, or npos if not found. An empty needle is found at position 0.
+ */
+constexpr size_t ifind(const std::string_view haystack, const std::string_view needle) {
+    if (!detail::is_constant_evaluated())
+        return detail::ifind_runtime(haystack, needle, detail::simd_level());
+
+    for (size_t pos = 0; pos + needle.size() <= haystack.size(); ++pos) {
+        if (iequals(haystack.substr(pos, needle.size()), needle))
+            return pos;
+    }
+    return std::string_view::npos;
+}
+
+/**
+ * Hashes a string ignoring ASCII case, so that strings which are equal according to iequals() have the same hash.
+ * @param str The string to hash.
+ * @return The hash.
+ */
+inline size_t ihash(const std::string_view str) {
+    return detail::ihash_runtime(str);
+}
+
+/**
+ * Case insensitive hash function object for unordered containers, to be used together with IEqual.
+ *
+ * Example:
+ *     std::unordered_map<std::string, int, rdk::IHash, rdk::IEqual> headers;
+ */
+struct IHash {
+    using is_transparent = void;
+
+    size_t operator()(const std::string_view str) const {
+        return ihash(str);
+    }
+};
+
+/**
+ * Case insensitive equality function object, see IHash.
+ */
+struct IEqual {
+    using is_transparent = void;
+
+    constexpr bool operator()(const std::string_view lhs, const std::string_view rhs) const {
+        return iequals(lhs, rhs);
+    }
+};
+
+/**
+ * Removes leading and trailing whitespace.
+ * @param string The string to trim.
+ * @return The string without leading and trailing ASCII whitespace.
+ */
+constexpr std::string_view trim(std::string_view string) {
+    while (!string.empty() && is_ascii_space(string.front())) {
+        string.remove_prefix(1);
+    }
+    while (!string.empty() && is_ascii_space(string.back())) {
+        string.remove_suffix(1);
+    }
+    return string;
+}
+
+/**
+ * Compares 2 string while taking numbers into account, following the rules of strnatcmp by Martin Pool: whitespace is
+ * ignored, runs of digits are compared by value, and runs of digits with leading zeros are compared as decimals (digit
+ * by digit). Characters are classified as ASCII regardless of the locale, and compared as unsigned values, so
+ * non-ASCII characters order after ASCII characters.
  * @param lhs Left hand side.
  * @param rhs Right hand side.
  * @param case_sensitive Whether the comparison should be case sensitive.
- * @return Comparison result.
+ * @return Comparison result: negative if lhs orders before rhs, positive if lhs orders after rhs, or 0 if equal.
  */
-inline int compare_natural(const std::string& lhs, const std::string& rhs, const bool case_sensitive) {
-    return case_sensitive ? strnatcmp(lhs.c_str(), rhs.c_str()) : strnatcasecmp(lhs.c_str(), rhs.c_str());
+constexpr int compare_natural(const std::string_view lhs, const std::string_view rhs, const bool case_sensitive) {
+    // Reading past the end gives a 0, which acts like the terminator of a C string.
+    const auto at = [](const std::string_view string, const size_t index) {
+        return index < string.size() ? string[index] : '\0';
+    };
+
+    size_t ai = 0;
+    size_t bi = 0;
+
+    while (true) {
+        auto ca = at(lhs, ai);
+        auto cb = at(rhs, bi);
+
+        while (is_ascii_space(ca)) {
+            ca = at(lhs, ++ai);
+        }
+
+        while (is_ascii_space(cb)) {
+            cb = at(rhs, ++bi);
+        }
+
+        if (is_ascii_digit(ca) && is_ascii_digit(cb)) {
+            if (ca == '0' || cb == '0') {
+                // Compare left aligned: the first different digit wins.
+                for (size_t i = 0;; ++i) {
+                    const auto a = at(lhs, ai + i);
+                    const auto b = at(rhs, bi + i);
+                    if (!is_ascii_digit(a) && !is_ascii_digit(b))
+                        break;
+                    if (!is_ascii_digit(a))
+                        return -1;
+                    if (!is_ascii_digit(b))
+                        return +1;
+                    if (a != b)
+                        return a < b ? -1 : +1;
+                }
+            } else {
+                // Compare right aligned: the longest run wins, otherwise the first different digit.
+                int bias = 0;
+                for (size_t i = 0;; ++i) {
+                    const auto a = at(lhs, ai + i);
+                    const auto b = at(rhs, bi + i);
+                    if (!is_ascii_digit(a) && !is_ascii_digit(b)) {
+                        if (bias != 0)
+                            return bias;
+                        break;
+                    }
+                    if (!is_ascii_digit(a))
+                        return -1;
+                    if (!is_ascii_digit(b))
+                        return +1;
+                    if (bias == 0 && a != b)
+                        bias = a < b ? -1 : +1;
+                }
+            }
+        }
+
+        if (ai >= lhs.size() && bi >= rhs.size())
+            return 0;
+
+        if (!case_sensitive) {
+            ca = to_ascii_upper(ca);
+            cb = to_ascii_upper(cb);
+        }
+
+        if (ca != cb)
+            return static_cast<unsigned char>(ca) < static_cast<unsigned char>(cb) ? -1 : +1;
+
+        ++ai;
+        ++bi;
+    }
 }
 
 /**
  * Can be used with std::sort to sort a vector of strings alphabetically and naturally.
  */
 struct NumericAwareSortFunctor {
-    bool operator()(const std::string& lhs, const std::string& rhs) const {
+    constexpr bool operator()(const std::string_view lhs, const std::string_view rhs) const {
         return compare_natural(lhs, rhs, false) < 0;
     }
 };
 
-inline size_t count_number_of_equal_characters_from_start(const std::vector<std::string>& strings) {
-    if (strings.size() <= 1)
-        return 0;
+/**
+ * Appends the natural sort key of given text to given key. See natural_sort_key().
+ * @param key The key to append to.
+ * @param text The text to create the key for.
+ * @param case_sensitive Whether the key should be case sensitive.
+ */
+inline void append_natural_sort_key(std::string& key, const std::string_view text, const bool case_sensitive) {
+    for (size_t i = 0; i < text.size();) {
+        const auto c = text[i];
 
-    const std::string& base = strings.front();
+        if (is_ascii_space(c)) {
+            ++i;
+            continue;
+        }
 
-    size_t highestMatchingIndex = std::numeric_limits<size_t>::max();
+        if (!is_ascii_digit(c)) {
+            key.push_back(case_sensitive ? c : to_ascii_upper(c));
+            ++i;
+            continue;
+        }
 
-    // Iterate strings, except the first one
-    for (size_t i = 1; i < strings.size(); ++i) {
-        // Iterate characters.
-        for (size_t ch = 0; ch < base.size() && ch < strings[i].size(); ++ch) {
-            if (strings[i][ch] != base[ch]) {
-                highestMatchingIndex = std::min(highestMatchingIndex, ch);
-                break;
+        auto end = i + 1;
+        while (end < text.size() && is_ascii_digit(text[end])) {
+            ++end;
+        }
+        const auto digits = text.substr(i, end - i);
+        i = end;
+
+        // Digit runs start with a '0', which orders them like a digit relative to other characters.
+        key.push_back('0');
+
+        if (digits.front() == '0') {
+            // Runs with leading zeros compare digit by digit (like decimals), and order before other runs.
+            key.push_back('\0');
+            key.append(digits);
+            key.push_back('\0');
+        } else if (digits.size() < 0xff) {
+            // Other runs compare by length first, and then digit by digit.
+            key.push_back(static_cast<char>(digits.size()));
+            key.append(digits);
+        } else {
+            const auto length = static_cast<uint32_t>(std::min<size_t>(digits.size(), UINT32_MAX));
+            key.push_back('\xff');
+            for (int shift = 24; shift >= 0; shift -= 8) {
+                key.push_back(static_cast<char>(length >> shift & 0xff));
             }
+            key.append(digits);
         }
     }
+}
 
-    if (highestMatchingIndex == std::numeric_limits<size_t>::max())
-        return 0;
+/**
+ * Creates a key for sorting strings naturally, which can be compared using plain byte comparison (std::string's
+ * operator<, or memcmp followed by the lengths). Sorting by key gives the same order as sorting with compare_natural(),
+ * so when sorting many strings, creating the keys once is much cheaper than comparing the strings naturally
+ * O(n log n) times.
+ * @param text The text to create the key for.
+ * @param case_sensitive Whether the key should be case sensitive.
+ * @return The key.
+ */
+inline std::string natural_sort_key(const std::string_view text, const bool case_sensitive = false) {
+    std::string key;
+    key.reserve(text.size() + 8);
+    append_natural_sort_key(key, text, case_sensitive);
+    return key;
+}
+
+/**
+ * Sorts given strings alphabetically and naturally, giving the same order as sorting with NumericAwareSortFunctor. The
+ * sort keys are created once up front, after which the strings are sorted by key. The sort is stable.
+ * @param strings The strings to sort.
+ * @param case_sensitive Whether sorting should be case sensitive.
+ */
+inline void natural_sort(std::vector<std::string>& strings, const bool case_sensitive = false) {
+    // Store all keys in a single buffer to avoid an allocation per key.
+    std::string keys;
+    std::vector<size_t> offsets;
+    offsets.reserve(strings.size() + 1);
+
+    for (const auto& string : strings) {
+        offsets.push_back(keys.size());
+        append_natural_sort_key(keys, string, case_sensitive);
+    }
+    offsets.push_back(keys.size());
+
+    const auto key_of = [&keys, &offsets](const size_t index) {
+        return std::string_view(keys).substr(offsets[index], offsets[index + 1] - offsets[index]);
+    };
+
+    std::vector<size_t> order(strings.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
 
-    return highestMatchingIndex;
+    std::sort(order.begin(), order.end(), [&key_of](const size_t lhs, const size_t rhs) {
+        const auto result = key_of(lhs).compare(key_of(rhs));
+        return result < 0 || (result == 0 && lhs < rhs);
+    });
+
+    std::vector<std::string> sorted;
+    sorted.reserve(strings.size());
+    for (const auto index : order) {
+        sorted.push_back(std::move(strings[index]));
+    }
+    strings = std::move(sorted);
 }
 
-inline std::string merge_strings(const std::vector<std::string>& strings, const char* couple_characters = " & ") {
-    if (strings.empty())
-        return {};
+/**
+ * @param lhs The first string.
+ * @param rhs The second string.
+ * @return The number of characters at the start which are equal in both strings.
+ */
+constexpr size_t common_prefix_length(const std::string_view lhs, const std::string_view rhs) {
+    return detail::mismatch(lhs, rhs);
+}
 
-    auto count = count_number_of_equal_characters_from_start(strings);
-    if (count == 0) {
-        // Just concatenate all strings
-        std::string output = strings.front();
-        for (size_t i = 1; i < strings.size(); ++i) {
-            output.append(couple_characters);
-            output.append(strings[i]);
-        }
-        return output;
+namespace detail {
+
+template<class Iterator>
+constexpr size_t common_prefix_length(Iterator begin, const Iterator end) {
+    if (begin == end)
+        return 0;
+
+    const std::string_view base = *begin;
+    size_t length = base.size();
+
+    // Every string is compared against the prefix which is still common, so the total work is linear.
+    for (++begin; begin != end && length > 0; ++begin) {
+        length = mismatch(base.substr(0, length), *begin);
     }
 
-    std::string output = strings.front();
+    return length;
+}
+
+template<class Iterator>
+std::string merge_strings(const Iterator begin, const Iterator end, const std::string_view couple_characters) {
+    if (begin == end)
+        return {};
+
+    const std::string_view base = *begin;
+    auto count = std::distance(begin, end) > 1 ? common_prefix_length(begin, end) : 0;
 
     // If the equal part contains a space, limit the amount of equal characters to that.
-    for (size_t i = 0; i < count; ++i) {
-        if (output[i] == ' ') {
-            count = i + 1;
-            break;
+    if (const auto space = base.substr(0, count).find(' '); space != std::string_view::npos) {
+        count = space + 1;
+    }
+
+    // Returns the part of a string to append, which is empty if the string adds nothing to the output.
+    const auto tail_of = [count](const std::string_view string) {
+        if (count == 0)
+            return string;
+        if (string.size() <= count)
+            return std::string_view();
+        auto tail = string.substr(count);
+        // When the common part ends right before a space, don't start the tail with it.
+        tail.remove_prefix(std::min(tail.find_first_not_of(' '), tail.size()));
+        return tail;
+    };
+
+    size_t size = base.size();
+    for (auto it = std::next(begin); it != end; ++it) {
+        const auto tail = tail_of(*it);
+        if (count == 0 || !tail.empty()) {
+            size += couple_characters.size() + tail.size();
         }
     }
 
-    for (size_t i = 1; i < strings.size(); ++i) {
-        if (strings[i].size() > count) {
+    std::string output;
+    output.reserve(size);
+    output.append(base);
+
+    for (auto it = std::next(begin); it != end; ++it) {
+        const auto tail = tail_of(*it);
+        if (count == 0 || !tail.empty()) {
             output.append(couple_characters);
-            output.append(strings[i].substr(count));
+            output.append(tail);
         }
     }
 
     return output;
 }
 
+}  // namespace detail
+
+/**
+ * Counts the number of characters at the start which are equal in all given strings. Strings are compared a word (or a
+ * SIMD register) at a time.
+ * @param strings The strings to compare.
+ * @return The length of the common prefix, or 0 if there are less than 2 strings.
+ */
+inline size_t count_number_of_equal_characters_from_start(const std::vector<std::string>& strings) {
+    return strings.size() <= 1 ? 0 : detail::common_prefix_length(strings.begin(), strings.end());
+}
+
+inline size_t count_number_of_equal_characters_from_start(const std::vector<std::string_view>& strings) {
+    return strings.size() <= 1 ? 0 : detail::common_prefix_length(strings.begin(), strings.end());
+}
+
+constexpr size_t count_number_of_equal_characters_from_start(const std::initializer_list<std::string_view> strings) {
+    return strings.size() <= 1 ? 0 : detail::common_prefix_length(strings.begin(), strings.end());
+}
+
+/**
+ * Merges strings with a common start into a single string, for example {"Input 1", "Input 2"} into "Input 1 & 2". The
+ * common part is limited to the first word (up to and including the first space) if it contains one. Strings which
+ * would add nothing are left out. Strings without a common start are concatenated.
+ * @param strings The strings to merge.
+ * @param couple_characters The characters to put between the parts.
+ * @return The merged string, which is allocated once.
+ */
+inline std::string
+merge_strings(const std::vector<std::string>& strings, const std::string_view couple_characters = " & ") {
+    return detail::merge_strings(strings.begin(), strings.end(), couple_characters);
+}
+
+inline std::string
+merge_strings(const std::vector<std::string_view>& strings, const std::string_view couple_characters = " & ") {
+    return detail::merge_strings(strings.begin(), strings.end(), couple_characters);
+}
+
+inline std::string
+merge_strings(const std::initializer_list<std::string_view> strings, const std::string_view couple_characters = " & ") {
+    return detail::merge_strings(strings.begin(), strings.end(), couple_characters);
+}
+
 }  // namespace rdk
@@ -8,16 +8,29 @@
 #include <algorithm>
 
 #include "Subscription.h"
+#include "rdk/detail/FlatPointerMap.h"
 #include "rdk/detail/NonCopyable.h"
 #include "rdk/detail/NonMoveable.h"
 
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace rdk {
 
 /**
  * List of subscribers which are internally held by a shared list. This allows the subscribers to have a different,
  * arbitrary lifetime than this list.
+ *
+ * Subscribers are stored in a dense array which is iterated when calling, and each Subscription refers to its entry
+ * through a generation checked slot. This makes adding and removing subscribers O(1). Removing a subscriber moves the
+ * last subscriber into its place, so the order in which subscribers are called is not preserved on removal.
+ *
+ * Subscribers may be added and removed from within call(), including nested calls. Subscribers added during a call are
+ * not called by calls which are already in progress, subscribers removed during a call are not called anymore. The
+ * removal of their entries is deferred until the outermost call returns, so calling never has to copy the list.
  * @tparam Type The type of the subscriber.
  */
 template<class Type>
@@ -37,46 +50,102 @@ class SubscriberList {
         if (subscriber == nullptr)
             return {};
 
+        auto& state = *state_;
+
         // Find an existing entry for subscriber.
-        for (auto& s : *subscribers_) {
-            if (s.subscriber == subscriber) {
-                s.count += 1;
-                return rdk::Subscription([subscribers = subscribers_, subscriber] {
-                    SubscriberList::unsubscribe(subscribers, subscriber);
-                });
+        auto [existing_slot, inserted] = state.slot_by_subscriber.try_emplace(subscriber, 0);
+
+        if (inserted) {
+            // No existing entry was found, so create a new one.
+            if (state.free_slots.empty()) {
+                state.slots.push_back(Slot {});
+                *existing_slot = static_cast<uint32_t>(state.slots.size() - 1);
+            } else {
+                *existing_slot = state.free_slots.back();
+                state.free_slots.pop_back();
             }
+
+            auto& slot = state.slots[*existing_slot];
+            slot.index = static_cast<uint32_t>(state.subscribers.size());
+            slot.count = 0;
+            state.subscribers.push_back(Entry {subscriber, *existing_slot});
         }
 
-        // No existing entry was found, so create a new one.
-        subscribers_->push_back(SubscriberAndCount {subscriber, 1});
+        const auto slot_index = *existing_slot;
+        auto& slot = state.slots[slot_index];
+        slot.count += 1;
 
-        return Subscription([subscribers = subscribers_, subscriber] {
-            SubscriberList::unsubscribe(subscribers, subscriber);
+        return Subscription([state = state_, slot_index, generation = slot.generation] {
+            SubscriberList::unsubscribe(*state, slot_index, generation);
         });
     }
 
     /**
-     * Calls all subscribers by calling back the given callback with each subscriber.
-     * @param cb The function to call.
+     * Calls all subscribers by calling back the given callback with each subscriber. The callback is taken as template
+     * argument so that it can be inlined into the loop, and calling never allocates.
+     * @param cb The function to call. Nullable callables (like an empty std::function) are ignored.
      * @param excluding If given, this subscriber will not be called.
      */
-    void call(const std::function<void(Type&)>& cb, Type* excluding = nullptr) const {
-        if (!cb) {
-            return;
+    template<class F>
+    void call(F&& cb, Type* excluding = nullptr) const {
+        if constexpr (std::is_constructible_v<bool, F>) {
+            if (!static_cast<bool>(cb)) {
+                return;
+            }
         }
 
-        for (auto& s : *subscribers_) {
-            if (s.subscriber != excluding) {
-                cb(*s.subscriber);
+        call_checked(
+            [&cb](Type& subscriber, const auto&) {
+                cb(subscriber);
+            },
+            excluding
+        );
+    }
+
+    /**
+     * Like call(), but the callback also receives a function which tells whether the subscriber is still part of the
+     * list. A callback which calls the subscriber more than once can use this to stop as soon as the subscriber
+     * unsubscribes (or is destroyed, which unsubscribes it).
+     * @param cb The function to call, with signature void(Type& subscriber, const IsSubscribed& is_subscribed), where
+     * is_subscribed() returns a bool.
+     * @param excluding If given, this subscriber will not be called.
+     */
+    template<class F>
+    void call_checked(F&& cb, Type* excluding = nullptr) const {
+        const DispatchScope scope(*state_);
+
+        // Subscribers may be added while calling, which can reallocate the array, hence the iteration by index.
+        const auto num_subscribers = state_->subscribers.size();
+        for (size_t i = 0; i < num_subscribers; ++i) {
+            auto* subscriber = state_->subscribers[i].subscriber;
+            if (subscriber != nullptr && subscriber != excluding) {
+                // Entries are only cleared while calling, not moved, so the entry stays at index i.
+                const auto is_subscribed = [&state = *state_, i, subscriber] {
+                    return state.subscribers[i].subscriber == subscriber;
+                };
+                cb(*subscriber, is_subscribed);
             }
         }
     }
 
+    /**
+     * Calls given member function on all subscribers.
+     * @param method The member function to call, for example &Type::on_value_changed.
+     * @param args The arguments to pass to the member function. These are passed to every subscriber, so they are never
+     * moved from.
+     */
+    template<class Method, class... Args>
+    void call_member(Method method, const Args&... args) const {
+        call([&](Type& subscriber) {
+            std::invoke(method, subscriber, args...);
+        });
+    }
+
     /**
      * @return The number of subscribers currently in the list.
      */
     [[nodiscard]] size_t get_num_subscribers() const {
-        return subscribers_->size();
+        return state_->subscribers.size() - state_->pending_removals.size();
     }
 
     /**
@@ -85,50 +154,107 @@ class SubscriberList {
      * @return True if given subscriber is part of the list, or false if not.
      */
     bool has_subscriber(Type* subscriber) const {
-        return std::any_of(subscribers_->begin(), subscribers_->end(), [subscriber](SubscriberAndCount& element) {
-            return element.subscriber == subscriber;
-        });
+        return state_->slot_by_subscriber.find(subscriber) != nullptr;
     }
 
     /**
      * @return Iterator to the beginning of the vector.
      */
     typename std::vector<Type*>::iterator begin() {
-        return subscribers_->begin();
+        return state_->subscribers.begin();
     }
 
     /**
      * @return Iterator to the end of the vector.
      */
     typename std::vector<Type*>::iterator end() {
-        return subscribers_->end();
+        return state_->subscribers.end();
     }
 
   private:
-    struct SubscriberAndCount {
+    struct Entry {
         Type* subscriber;
-        size_t count;
+        uint32_t slot;
     };
 
-    std::shared_ptr<std::vector<SubscriberAndCount>> subscribers_ {std::make_shared<std::vector<SubscriberAndCount>>()};
-
-    static void
-    unsubscribe(const std::shared_ptr<std::vector<SubscriberAndCount>>& subscribers, Type* subscriberToRemove) {
-        subscribers->erase(
-            std::remove_if(
-                subscribers->begin(),
-                subscribers->end(),
-                [subscriberToRemove](SubscriberAndCount& sc) {
-                    if (sc.subscriber == subscriberToRemove) {
-                        if (sc.count <= 1)
-                            return true;
-                        --sc.count;
-                    }
-                    return false;
+    struct Slot {
+        uint32_t index {};       // Index into the dense array of subscribers.
+        uint32_t generation {};  // Incremented each time the slot is freed, invalidating existing handles.
+        size_t count {};         // Number of subscriptions for the subscriber.
+    };
+
+    struct State {
+        std::vector<Entry> subscribers;
+        std::vector<Slot> slots;
+        std::vector<uint32_t> free_slots;
+        detail::FlatPointerMap<Type, uint32_t> slot_by_subscriber;  // Doesn't allocate per subscriber.
+        size_t dispatch_depth {0};
+        std::vector<uint32_t> pending_removals;  // Slots of subscribers which were removed while calling.
+    };
+
+    /**
+     * Marks the list as being called for the duration of its lifetime. Removals which happened in the meantime are
+     * applied when the outermost scope ends.
+     */
+    class DispatchScope {
+      public:
+        explicit DispatchScope(State& state) : state_(state) {
+            ++state_.dispatch_depth;
+        }
+
+        ~DispatchScope() {
+            if (--state_.dispatch_depth == 0 && !state_.pending_removals.empty()) {
+                for (const auto slot_index : state_.pending_removals) {
+                    remove_entry(state_, slot_index);
                 }
-            ),
-            subscribers->end()
-        );
+                state_.pending_removals.clear();
+            }
+        }
+
+        RDK_DECLARE_NON_COPYABLE(DispatchScope)
+        RDK_DECLARE_NON_MOVEABLE(DispatchScope)
+
+      private:
+        State& state_;
+    };
+
+    std::shared_ptr<State> state_ {std::make_shared<State>()};
+
+    static void unsubscribe(State& state, const uint32_t slot_index, const uint32_t generation) {
+        auto& slot = state.slots[slot_index];
+
+        if (slot.generation != generation)
+            return;
+
+        if (slot.count > 1) {
+            slot.count -= 1;
+            return;
+        }
+
+        state.slot_by_subscriber.erase(state.subscribers[slot.index].subscriber);
+        slot.count = 0;
+        slot.generation += 1;
+
+        if (state.dispatch_depth > 0) {
+            // Moving subscribers around while calling would make the call skip or repeat subscribers, so only clear the
+            // entry for now and remove it when the call returns.
+            state.subscribers[slot.index].subscriber = nullptr;
+            state.pending_removals.push_back(slot_index);
+            return;
+        }
+
+        remove_entry(state, slot_index);
+    }
+
+    static void remove_entry(State& state, const uint32_t slot_index) {
+        const auto index = state.slots[slot_index].index;
+
+        // Move the last subscriber into the place of the removed one.
+        state.subscribers[index] = state.subscribers.back();
+        state.slots[state.subscribers[index].slot].index = index;
+        state.subscribers.pop_back();
+
+        state.free_slots.push_back(slot_index);
     }
 };
 
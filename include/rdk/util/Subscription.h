@@ -1,20 +1,25 @@
 #pragma once
 
-#include <cassert>
-#include <functional>
+#include "InplaceFunction.h"
+
+#include <type_traits>
+#include <utility>
 
 namespace rdk {
 
 /**
  * A simple class which executes given function upon destruction.
  * Very suitable for subscriptions which must go out of scope when the owning class gets destructed.
+ * The function is stored inline (see InplaceFunction), so creating a Subscription never allocates. Callables which are
+ * too big result in a compile time error, in which case they can be explicitly wrapped in a std::function.
  */
 class Subscription {
   public:
     Subscription() = default;
 
-    explicit Subscription(std::function<void()> onDestructionCallback) :
-        on_destruction_callback_(std::move(onDestructionCallback)) {}
+    template<class F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Subscription>>>
+    explicit Subscription(F&& onDestructionCallback) :
+        on_destruction_callback_(std::forward<F>(onDestructionCallback)) {}
 
     Subscription(const Subscription& other) = delete;
 
@@ -28,7 +33,7 @@ class Subscription {
     }
 
     explicit operator bool() const {
-        return on_destruction_callback_ != nullptr;
+        return static_cast<bool>(on_destruction_callback_);
     }
 
     Subscription& operator=(const Subscription& other) = delete;
@@ -37,20 +42,18 @@ class Subscription {
         if (on_destruction_callback_)
             on_destruction_callback_();
 
+        // Moving an InplaceFunction leaves the source empty.
         on_destruction_callback_ = std::move(other.on_destruction_callback_);
-        other.on_destruction_callback_ = nullptr;
-
-        // Apparently a move doesn't reset the std::function
-        assert(other.on_destruction_callback_ == nullptr);
 
         return *this;
     }
 
-    Subscription& operator=(std::function<void()>&& onDestructionCallback) noexcept {
+    template<class F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, Subscription>>>
+    Subscription& operator=(F&& onDestructionCallback) noexcept {
         if (on_destruction_callback_)
             on_destruction_callback_();
 
-        on_destruction_callback_ = std::move(onDestructionCallback);
+        on_destruction_callback_ = std::forward<F>(onDestructionCallback);
 
         return *this;
     }
@@ -71,7 +74,7 @@ class Subscription {
     }
 
   private:
-    std::function<void()> on_destruction_callback_;
+    InplaceFunction<void()> on_destruction_callback_;
 };
 
 using Defer = Subscription;
@@ -0,0 +1,604 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include "InplaceFunction.h"
+#include "Subscription.h"
+#include "TimerWheel.h"
+#include "rdk/detail/NonCopyable.h"
+#include "rdk/detail/NonMoveable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace rdk {
+
+/**
+ * Thread pool for scheduling tasks, while keeping the lifetime of the tasks bound to the instance of TaskScheduler.
+ *
+ * Each worker thread has its own queue. Tasks scheduled from a worker thread are added to the queue of that worker,
+ * tasks scheduled from other threads are distributed over the workers. A worker takes the most recently added task from
+ * its own queue, and workers which run out of work steal the oldest task from the other workers. Tasks are stored in an
+ * InplaceFunction and in recycled slots, and the queues are ring buffers which only grow, so scheduling a task doesn't
+ * allocate (after warming up).
+ *
+ * Delayed and periodic tasks are kept in a hierarchical timer wheel (see TimerWheel) with a resolution of 1 ms, which
+ * is driven by a timer thread that is started on first use. Expired timers are posted to the worker threads.
+ *
+ * Destroying the scheduler cancels all pending tasks and timers, and waits for running tasks to finish. Tasks scheduled
+ * through schedule(), schedule_after() and schedule_every() can also be cancelled individually by destroying the
+ * returned Subscription.
+ */
+class TaskScheduler {
+  public:
+    using Task = InplaceFunction<void()>;
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * The resolution of delayed and periodic tasks.
+     */
+    static constexpr auto kTimerResolution = std::chrono::milliseconds(1);
+
+    /**
+     * Constructor.
+     * @param num_threads The number of worker threads. Defaults to the number of hardware threads.
+     */
+    explicit TaskScheduler(size_t num_threads = std::max(1u, std::thread::hardware_concurrency())) {
+        num_threads = std::max<size_t>(1, num_threads);
+
+        for (size_t i = 0; i < num_threads; ++i) {
+            state_->workers.push_back(std::make_unique<Worker>());
+            state_->workers.back()->index = i;
+        }
+
+        for (auto& worker : state_->workers) {
+            worker->thread = std::thread(&TaskScheduler::run_worker, state_.get(), worker.get());
+        }
+    }
+
+    /**
+     * Cancels all pending tasks and timers, and waits for running tasks to finish. Must not be called from a task
+     * running on this scheduler.
+     */
+    ~TaskScheduler() {
+        assert(current_state_ != state_.get());
+
+        // Stop the timer thread first, so it won't post any more tasks.
+        {
+            std::lock_guard lock(state_->timer_mutex);
+            state_->timers_stopping = true;
+        }
+        state_->timer_wake_up.notify_all();
+
+        if (state_->timer_thread.joinable()) {
+            state_->timer_thread.join();
+        }
+
+        {
+            std::lock_guard lock(state_->sleep_mutex);
+            state_->stopping.store(true);
+        }
+        state_->wake_up.notify_all();
+
+        for (auto& worker : state_->workers) {
+            worker->thread.join();
+        }
+
+        for (auto& worker : state_->workers) {
+            while (auto* slot = worker->queue.pop_front()) {
+                finish(*slot);
+            }
+        }
+
+        // Release all remaining timers, which invalidates the subscriptions which refer to them.
+        std::vector<Task> released;
+        {
+            std::lock_guard lock(state_->timer_mutex);
+            for (auto& timer : state_->timers) {
+                if (timer.status != TimerStatus::kFree) {
+                    released.push_back(release_timer(*state_, timer));
+                }
+            }
+        }
+    }
+
+    RDK_DECLARE_NON_COPYABLE(TaskScheduler)
+    RDK_DECLARE_NON_MOVEABLE(TaskScheduler)
+
+    /**
+     * Schedules a task for execution on one of the worker threads. The task will be cancelled if it didn't run before
+     * this scheduler is destroyed.
+     * @param task The task to execute.
+     */
+    template<class F>
+    void post(F&& task) {
+        enqueue(*state_, Task(std::forward<F>(task)));
+    }
+
+    /**
+     * Schedules a task for execution on one of the worker threads.
+     * @param task The task to execute.
+     * @return A subscription which cancels the task when destroyed. If the task is running at that moment, destruction
+     * waits for the task to finish (unless destroyed from within the task itself), so once the subscription is gone the
+     * task is guaranteed to not be running anymore.
+     */
+    template<class F>
+    [[nodiscard]] Subscription schedule(F&& task) {
+        auto [slot, generation] = enqueue(*state_, Task(std::forward<F>(task)));
+        return Subscription([state = state_, slot = slot, generation = generation] {
+            cancel(*state, *slot, generation);
+        });
+    }
+
+    /**
+     * Schedules a task for execution on one of the worker threads, after given delay.
+     * @param delay The minimum time to wait before running the task. Rounded up to the timer resolution.
+     * @param task The task to execute.
+     * @return A subscription which cancels the task when destroyed, with the same guarantees as schedule().
+     */
+    template<class Rep, class Period, class F>
+    [[nodiscard]] Subscription schedule_after(const std::chrono::duration<Rep, Period> delay, F&& task) {
+        return arm_timer(delay, 0, Task(std::forward<F>(task)));
+    }
+
+    /**
+     * Schedules a task for repeated execution on one of the worker threads, first after one period. Runs of the task
+     * never overlap. If running the task takes longer than the period, the missed runs are skipped.
+     * @param period The time between consecutive runs. Rounded up to the timer resolution.
+     * @param task The task to execute.
+     * @return A subscription which cancels the task when destroyed, with the same guarantees as schedule().
+     */
+    template<class Rep, class Period, class F>
+    [[nodiscard]] Subscription schedule_every(const std::chrono::duration<Rep, Period> period, F&& task) {
+        const auto period_ticks = std::max<uint64_t>(1, to_ticks(period));
+        return arm_timer(period, period_ticks, Task(std::forward<F>(task)));
+    }
+
+    /**
+     * @return The number of worker threads.
+     */
+    [[nodiscard]] size_t get_num_threads() const {
+        return state_->workers.size();
+    }
+
+  private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    enum Status : uint64_t { kPending = 0, kRunning = 1, kCancelled = 2, kFree = 3 };
+
+    /**
+     * Storage for a single task. The state holds the generation of the slot in the upper bits and the status in the
+     * lower 2 bits. The generation is incremented every time the slot is freed, which invalidates existing handles.
+     */
+    struct TaskSlot {
+        Task task;
+        std::atomic<uint64_t> state {kFree};
+    };
+
+    /**
+     * Double ended queue of tasks in a ring buffer, which only allocates when it grows beyond its largest size so far.
+     * The owning worker pops from the back, where it also pushes, and other workers steal from the front.
+     */
+    class TaskQueue {
+      public:
+        void push_back(TaskSlot* const slot) {
+            if (size_ == buffer_.size()) {
+                grow();
+            }
+            buffer_[(head_ + size_) & mask()] = slot;
+            size_++;
+        }
+
+        /**
+         * @return The most recently pushed task, or nullptr if the queue is empty.
+         */
+        TaskSlot* pop_back() {
+            if (size_ == 0)
+                return nullptr;
+            size_--;
+            return buffer_[(head_ + size_) & mask()];
+        }
+
+        /**
+         * @return The least recently pushed task, or nullptr if the queue is empty.
+         */
+        TaskSlot* pop_front() {
+            if (size_ == 0)
+                return nullptr;
+            auto* slot = buffer_[head_];
+            head_ = (head_ + 1) & mask();
+            size_--;
+            return slot;
+        }
+
+      private:
+        static constexpr size_t kMinCapacity = 64;  // Must be a power of two.
+
+        std::vector<TaskSlot*> buffer_;
+        size_t head_ {0};
+        size_t size_ {0};
+
+        [[nodiscard]] size_t mask() const {
+            return buffer_.size() - 1;
+        }
+
+        void grow() {
+            std::vector<TaskSlot*> grown(buffer_.empty() ? kMinCapacity : buffer_.size() * 2);
+            for (size_t i = 0; i < size_; ++i) {
+                grown[i] = buffer_[(head_ + i) & mask()];
+            }
+            buffer_ = std::move(grown);
+            head_ = 0;
+        }
+    };
+
+    struct alignas(kCacheLineSize) Worker {
+        std::mutex mutex;
+        TaskQueue queue;                    // Guarded by mutex.
+        std::deque<TaskSlot> slots;         // Guarded by mutex. A deque is used for its stable addresses.
+        std::vector<TaskSlot*> free_slots;  // Guarded by mutex.
+        std::thread thread;
+        size_t index {};
+    };
+
+    enum class TimerStatus { kFree, kArmed, kQueued, kRunning, kCancelled };
+
+    /**
+     * Storage for a delayed or periodic task. Guarded by State::timer_mutex.
+     */
+    struct TimerRecord {
+        Task task;
+        uint64_t expiry {};  // In ticks.
+        uint64_t period {};  // In ticks, or 0 for a task which runs once.
+        uint64_t generation {};
+        TimerStatus status {TimerStatus::kFree};
+        TimerWheel<TimerRecord*>::TimerId id;
+    };
+
+    struct State {
+        std::vector<std::unique_ptr<Worker>> workers;
+        std::atomic<size_t> next_worker {0};
+        std::atomic<size_t> num_queued {0};
+        std::atomic<size_t> num_sleeping {0};
+        std::atomic<bool> stopping {false};
+        std::mutex sleep_mutex;
+        std::condition_variable wake_up;
+
+        std::atomic<size_t> num_cancelling {0};  // The number of threads waiting in cancel() for a running task.
+        std::mutex cancel_mutex;
+        std::condition_variable task_finished;  // Notified when a task finished while num_cancelling > 0.
+
+        const Clock::time_point start {Clock::now()};  // Tick 0 of the timer wheel.
+        std::mutex timer_mutex;
+        std::condition_variable timer_wake_up;   // Wakes the timer thread.
+        std::condition_variable timer_finished;  // Notified when a timer task finished running.
+        TimerWheel<TimerRecord*> timer_wheel;    // Guarded by timer_mutex.
+        std::deque<TimerRecord> timers;          // Guarded by timer_mutex. A deque is used for its stable addresses.
+        std::vector<TimerRecord*> free_timers;   // Guarded by timer_mutex.
+        std::thread timer_thread;                // Guarded by timer_mutex.
+        uint64_t timer_wake_tick {UINT64_MAX};   // Guarded by timer_mutex. The tick the timer thread sleeps until.
+        bool timers_stopping {false};            // Guarded by timer_mutex.
+    };
+
+    inline static thread_local State* current_state_ {nullptr};
+    inline static thread_local Worker* current_worker_ {nullptr};
+    inline static thread_local TaskSlot* current_slot_ {nullptr};
+    inline static thread_local TimerRecord* current_timer_ {nullptr};
+
+    std::shared_ptr<State> state_ {std::make_shared<State>()};
+
+    static uint64_t generation_of(const uint64_t state) {
+        return state >> 2;
+    }
+
+    static uint64_t status_of(const uint64_t state) {
+        return state & 3;
+    }
+
+    static uint64_t make_state(const uint64_t generation, const Status status) {
+        return generation << 2 | status;
+    }
+
+    static std::pair<TaskSlot*, uint64_t> enqueue(State& state, Task&& task) {
+        // Tasks scheduled from a worker go into the queue of that worker, others are distributed round-robin.
+        auto* worker = current_state_ == &state ? current_worker_ : nullptr;
+        if (worker == nullptr) {
+            worker = state.workers[state.next_worker.fetch_add(1, std::memory_order_relaxed) % state.workers.size()]
+                         .get();
+        }
+
+        TaskSlot* slot;
+        uint64_t generation;
+
+        {
+            std::lock_guard lock(worker->mutex);
+
+            if (worker->free_slots.empty()) {
+                slot = &worker->slots.emplace_back();
+            } else {
+                slot = worker->free_slots.back();
+                worker->free_slots.pop_back();
+            }
+
+            slot->task = std::move(task);
+            generation = generation_of(slot->state.load(std::memory_order_relaxed));
+            slot->state.store(make_state(generation, kPending), std::memory_order_relaxed);
+            state.num_queued.fetch_add(1);
+            worker->queue.push_back(slot);
+        }
+
+        if (state.num_sleeping.load() > 0) {
+            std::lock_guard lock(state.sleep_mutex);
+            state.wake_up.notify_one();
+        }
+
+        return {slot, generation};
+    }
+
+    static void cancel(State& state, TaskSlot& slot, const uint64_t generation) {
+        auto current = slot.state.load();
+
+        while (generation_of(current) == generation) {
+            const auto status = status_of(current);
+
+            if (status == kPending) {
+                if (slot.state.compare_exchange_weak(current, make_state(generation, kCancelled)))
+                    return;
+                continue;
+            }
+
+            if (status != kRunning || current_slot_ == &slot)
+                return;
+
+            // The task is running on another thread, wait for it to finish. Announcing the wait before checking the
+            // state again makes sure that finish() either sees the waiter and notifies, or finished before the check.
+            state.num_cancelling.fetch_add(1);
+            {
+                std::unique_lock lock(state.cancel_mutex);
+                state.task_finished.wait(lock, [&slot, &current, generation] {
+                    current = slot.state.load();
+                    return generation_of(current) != generation || status_of(current) != kRunning;
+                });
+            }
+            state.num_cancelling.fetch_sub(1);
+        }
+    }
+
+    static TaskSlot* pop_task(State& state, Worker& self) {
+        {
+            std::lock_guard lock(self.mutex);
+            if (auto* slot = self.queue.pop_back())
+                return slot;
+        }
+
+        // Steal the oldest task of another worker, which is the least likely to be hot in the cache of its worker.
+        const auto num_workers = state.workers.size();
+        for (size_t i = 1; i < num_workers; ++i) {
+            auto& worker = *state.workers[(self.index + i) % num_workers];
+            std::lock_guard lock(worker.mutex);
+            if (auto* slot = worker.queue.pop_front())
+                return slot;
+        }
+
+        return nullptr;
+    }
+
+    static void finish(TaskSlot& slot) {
+        slot.task.reset();
+        const auto generation = generation_of(slot.state.load());
+        slot.state.store(make_state(generation + 1, kFree));
+    }
+
+    static void run_task(State& state, Worker& self, TaskSlot& slot) {
+        auto expected = slot.state.load();
+        const auto generation = generation_of(expected);
+
+        if (status_of(expected) == kPending
+            && slot.state.compare_exchange_strong(expected, make_state(generation, kRunning))) {
+            current_slot_ = &slot;
+            slot.task();
+            current_slot_ = nullptr;
+        }
+
+        finish(slot);
+
+        if (state.num_cancelling.load() > 0) {
+            std::lock_guard lock(state.cancel_mutex);
+            state.task_finished.notify_all();
+        }
+
+        std::lock_guard lock(self.mutex);
+        self.free_slots.push_back(&slot);
+    }
+
+    template<class Rep, class Period>
+    static uint64_t to_ticks(const std::chrono::duration<Rep, Period> duration) {
+        const auto ticks = std::chrono::ceil<std::remove_const_t<decltype(kTimerResolution)>>(duration).count();
+        return ticks > 0 ? static_cast<uint64_t>(ticks) : 0;
+    }
+
+    /**
+     * @return The number of ticks which have fully elapsed since start. Rounded down (unlike to_ticks()), so that a
+     * wake-up in the middle of a tick doesn't expire the timers of that tick early.
+     */
+    static uint64_t current_tick(const State& state) {
+        const auto elapsed = Clock::now() - state.start;
+        const auto ticks = std::chrono::floor<std::remove_const_t<decltype(kTimerResolution)>>(elapsed).count();
+        return ticks > 0 ? static_cast<uint64_t>(ticks) : 0;
+    }
+
+    template<class Rep, class Period>
+    Subscription arm_timer(const std::chrono::duration<Rep, Period> delay, const uint64_t period, Task&& task) {
+        auto& state = *state_;
+        std::lock_guard lock(state.timer_mutex);
+
+        if (state.timers_stopping)
+            return {};
+
+        if (!state.timer_thread.joinable()) {
+            state.timer_thread = std::thread(&TaskScheduler::run_timers, &state);
+        }
+
+        TimerRecord* timer;
+        if (state.free_timers.empty()) {
+            timer = &state.timers.emplace_back();
+        } else {
+            timer = state.free_timers.back();
+            state.free_timers.pop_back();
+        }
+
+        // Round the expiry up, so the task never runs before the delay has passed.
+        timer->task = std::move(task);
+        timer->expiry = to_ticks(Clock::now() - state.start + delay);
+        timer->period = period;
+        arm_in_wheel(state, *timer);
+
+        return Subscription([state = state_, timer, generation = timer->generation] {
+            cancel_timer(*state, *timer, generation);
+        });
+    }
+
+    static void arm_in_wheel(State& state, TimerRecord& timer) {
+        timer.status = TimerStatus::kArmed;
+        timer.id = state.timer_wheel.arm(timer.expiry, &timer);
+
+        // Only wake up the timer thread if it would otherwise sleep past the expiry.
+        if (timer.expiry < state.timer_wake_tick) {
+            state.timer_wake_up.notify_one();
+        }
+    }
+
+    /**
+     * Frees given timer, and returns its task so that it can be destroyed after releasing the lock.
+     */
+    static Task release_timer(State& state, TimerRecord& timer) {
+        Task task = std::move(timer.task);
+        timer.generation++;
+        timer.status = TimerStatus::kFree;
+        state.free_timers.push_back(&timer);
+        return task;
+    }
+
+    static void cancel_timer(State& state, TimerRecord& timer, const uint64_t generation) {
+        Task released;
+        std::unique_lock lock(state.timer_mutex);
+
+        while (timer.generation == generation) {
+            switch (timer.status) {
+                case TimerStatus::kArmed:
+                    state.timer_wheel.cancel(timer.id);
+                    released = release_timer(state, timer);
+                    return;
+                case TimerStatus::kQueued:
+                    // The posted task will release the timer.
+                    timer.status = TimerStatus::kCancelled;
+                    return;
+                case TimerStatus::kRunning:
+                    if (current_timer_ == &timer) {
+                        timer.status = TimerStatus::kCancelled;
+                        return;
+                    }
+                    // The task is running on another thread, wait for it to finish.
+                    state.timer_finished.wait(lock);
+                    break;
+                case TimerStatus::kFree:
+                case TimerStatus::kCancelled:
+                    return;
+            }
+        }
+    }
+
+    static void run_timer(State& state, TimerRecord& timer, const uint64_t generation) {
+        Task released;
+        std::unique_lock lock(state.timer_mutex);
+
+        if (timer.generation != generation)
+            return;
+
+        if (timer.status == TimerStatus::kCancelled) {
+            released = release_timer(state, timer);
+            return;
+        }
+
+        timer.status = TimerStatus::kRunning;
+        lock.unlock();
+
+        current_timer_ = &timer;
+        timer.task();
+        current_timer_ = nullptr;
+
+        lock.lock();
+
+        if (timer.status == TimerStatus::kRunning && timer.period > 0) {
+            // Skip the runs which were missed, instead of running the task repeatedly to catch up.
+            const auto now = state.timer_wheel.now();
+            if (timer.expiry + timer.period <= now) {
+                timer.expiry += (now - timer.expiry) / timer.period * timer.period;
+            }
+            timer.expiry += timer.period;
+            arm_in_wheel(state, timer);
+        } else {
+            released = release_timer(state, timer);
+        }
+
+        state.timer_finished.notify_all();
+    }
+
+    static void run_timers(State* state) {
+        std::unique_lock lock(state->timer_mutex);
+
+        while (!state->timers_stopping) {
+            state->timer_wheel.advance(current_tick(*state), [state](TimerRecord* timer) {
+                timer->status = TimerStatus::kQueued;
+                enqueue(*state, Task([state, timer, generation = timer->generation] {
+                    run_timer(*state, *timer, generation);
+                }));
+            });
+
+            if (state->timer_wheel.empty()) {
+                state->timer_wake_tick = UINT64_MAX;
+                state->timer_wake_up.wait(lock);
+            } else {
+                state->timer_wake_tick = state->timer_wheel.next_event();
+                const auto wake_tick = static_cast<Clock::rep>(state->timer_wake_tick);
+                state->timer_wake_up.wait_until(lock, state->start + kTimerResolution * wake_tick);
+            }
+        }
+    }
+
+    static void run_worker(State* state, Worker* self) {
+        current_state_ = state;
+        current_worker_ = self;
+
+        while (!state->stopping.load()) {
+            if (auto* slot = pop_task(*state, *self)) {
+                state->num_queued.fetch_sub(1);
+                run_task(*state, *self, *slot);
+                continue;
+            }
+
+            std::unique_lock lock(state->sleep_mutex);
+            state->num_sleeping.fetch_add(1);
+            state->wake_up.wait(lock, [state] {
+                return state->num_queued.load() > 0 || state->stopping.load();
+            });
+            state->num_sleeping.fetch_sub(1);
+        }
+    }
+};
+
+}  // namespace rdk
@@ -0,0 +1,282 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace rdk {
+
+/**
+ * Hierarchical timer wheel, which keeps track of a large number of timers with O(1) arming and cancelling.
+ *
+ * Time is expressed in ticks, the meaning of a tick is up to the user. The wheel consists of 4 levels of 256 slots,
+ * each level covering 256 times the range of the level below. Timers are put in the lowest level which covers their
+ * expiry, and are moved down one level (cascaded) when the level below wraps around. Timers which expire more than 2^32
+ * ticks ahead are kept aside and reconsidered whenever the highest level cascades, which is every 2^24 ticks.
+ *
+ * This class is not thread safe.
+ *
+ * @tparam T The type of the value associated with each timer. Must be default constructible and movable.
+ */
+template<class T>
+class TimerWheel {
+  public:
+    /**
+     * Identifies an armed timer.
+     */
+    struct TimerId {
+        uint32_t index {kNone};
+        uint32_t generation {};
+    };
+
+    /**
+     * Constructor.
+     * @param now The tick to start at.
+     */
+    explicit TimerWheel(const uint64_t now = 0) : current_(now) {
+        for (auto& level : heads_) {
+            level.fill(kNone);
+        }
+    }
+
+    /**
+     * Arms a timer.
+     * @param expiry The tick at which the timer expires. Timers with an expiry in the past expire at the next tick.
+     * @param value The value associated with the timer, which is passed back when the timer expires.
+     * @return The id of the timer, which can be used to cancel it.
+     */
+    TimerId arm(const uint64_t expiry, T value) {
+        uint32_t index;
+
+        if (free_nodes_.empty()) {
+            index = static_cast<uint32_t>(nodes_.size());
+            nodes_.emplace_back();
+        } else {
+            index = free_nodes_.back();
+            free_nodes_.pop_back();
+        }
+
+        auto& node = nodes_[index];
+        node.value = std::move(value);
+        node.expiry = std::max(expiry, current_ + 1);
+        node.armed = true;
+        insert(index);
+        num_armed_++;
+
+        return {index, node.generation};
+    }
+
+    /**
+     * Cancels a timer.
+     * @param id The id of the timer.
+     * @return True if the timer was cancelled, or false if it already expired or was cancelled before.
+     */
+    bool cancel(const TimerId id) {
+        if (id.index >= nodes_.size())
+            return false;
+
+        auto& node = nodes_[id.index];
+        if (!node.armed || node.generation != id.generation)
+            return false;
+
+        unlink(id.index);
+        release(id.index);
+        return true;
+    }
+
+    /**
+     * Advances the wheel up to and including given tick, calling back for every timer which expired on the way. Timers
+     * may be armed and cancelled from within the callback.
+     * @param now The tick to advance to.
+     * @param on_expired The function to call for each expired timer, with signature void(T&& value).
+     */
+    template<class F>
+    void advance(const uint64_t now, F&& on_expired) {
+        while (current_ < now) {
+            if (num_armed_ == 0) {
+                current_ = now;
+                return;
+            }
+
+            // Skip the ticks at which nothing happens.
+            const auto next = next_event();
+            if (next > now) {
+                current_ = now;
+                return;
+            }
+            current_ = next;
+
+            // Move timers of the higher levels down once the levels below wrap around.
+            for (size_t level = 1; level < kNumLevels && (current_ & mask(level)) == 0; ++level) {
+                cascade(level);
+            }
+
+            // Take the timers off the slot one by one, as the callback might cancel any of the others. Timers armed by
+            // the callback always end up in a different slot.
+            auto& slot_head = heads_[0][current_ & (kNumSlots - 1)];
+            while (slot_head != kNone) {
+                const auto index = slot_head;
+                unlink(index);
+                T value = std::move(nodes_[index].value);
+                release(index);
+                on_expired(std::move(value));
+            }
+        }
+    }
+
+    /**
+     * Returns the tick at which advance() has to be called next. No timer expires before this tick, but a timer might
+     * not expire at this tick either, as it can also be the tick at which timers are cascaded.
+     * @return The tick of the next event.
+     */
+    [[nodiscard]] uint64_t next_event() const {
+        // All timers in level 0 expire within the current rotation of level 0, after which timers cascade down.
+        const auto end_of_rotation = (current_ | mask(1)) + 1;
+        for (auto tick = current_ + 1; tick < end_of_rotation; ++tick) {
+            if (heads_[0][tick & (kNumSlots - 1)] != kNone) {
+                return tick;
+            }
+        }
+        return end_of_rotation;
+    }
+
+    /**
+     * @return The tick the wheel is currently at.
+     */
+    [[nodiscard]] uint64_t now() const {
+        return current_;
+    }
+
+    /**
+     * @return The number of armed timers.
+     */
+    [[nodiscard]] size_t size() const {
+        return num_armed_;
+    }
+
+    /**
+     * @return True if there are no armed timers.
+     */
+    [[nodiscard]] bool empty() const {
+        return num_armed_ == 0;
+    }
+
+  private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+    static constexpr size_t kNumLevels = 4;
+    static constexpr size_t kBitsPerLevel = 8;
+    static constexpr size_t kNumSlots = 1 << kBitsPerLevel;
+    static constexpr uint32_t kOverflow = kNumLevels * kNumSlots;  // Slot id of the overflow list.
+
+    struct Node {
+        T value {};
+        uint64_t expiry {};
+        uint32_t prev {kNone};
+        uint32_t next {kNone};
+        uint32_t slot {kNone};
+        uint32_t generation {};
+        bool armed {false};
+    };
+
+    uint64_t current_ {};
+    size_t num_armed_ {};
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> free_nodes_;
+    std::array<std::array<uint32_t, kNumSlots>, kNumLevels> heads_ {};
+    uint32_t overflow_head_ {kNone};
+
+    static constexpr uint64_t mask(const size_t level) {
+        return (uint64_t {1} << (kBitsPerLevel * level)) - 1;
+    }
+
+    uint32_t& head(const uint32_t slot) {
+        return slot == kOverflow ? overflow_head_ : heads_[slot / kNumSlots][slot % kNumSlots];
+    }
+
+    void insert(const uint32_t index) {
+        auto& node = nodes_[index];
+
+        // Find the lowest level at which the expiry and the current tick share all higher bits.
+        uint32_t slot = kOverflow;
+        for (size_t level = 0; level < kNumLevels; ++level) {
+            const auto shift = kBitsPerLevel * (level + 1);
+            if ((node.expiry >> shift) == (current_ >> shift)) {
+                const auto slot_index = (node.expiry >> (kBitsPerLevel * level)) & (kNumSlots - 1);
+                slot = static_cast<uint32_t>(level * kNumSlots + slot_index);
+                break;
+            }
+        }
+
+        auto& h = head(slot);
+        node.slot = slot;
+        node.prev = kNone;
+        node.next = h;
+        if (h != kNone) {
+            nodes_[h].prev = index;
+        }
+        h = index;
+    }
+
+    void unlink(const uint32_t index) {
+        auto& node = nodes_[index];
+
+        if (node.prev != kNone) {
+            nodes_[node.prev].next = node.next;
+        } else {
+            head(node.slot) = node.next;
+        }
+
+        if (node.next != kNone) {
+            nodes_[node.next].prev = node.prev;
+        }
+    }
+
+    void release(const uint32_t index) {
+        auto& node = nodes_[index];
+        node.value = T {};
+        node.armed = false;
+        node.generation++;
+        free_nodes_.push_back(index);
+        num_armed_--;
+    }
+
+    /**
+     * Detaches the list of given slot, and returns its first node.
+     */
+    uint32_t detach(const size_t level, const uint64_t slot_index) {
+        auto& h = heads_[level][slot_index];
+        const auto first = h;
+        h = kNone;
+        return first;
+    }
+
+    void cascade(const size_t level) {
+        auto index = detach(level, (current_ >> (kBitsPerLevel * level)) & (kNumSlots - 1));
+
+        // Reconsider the timers which were too far ahead whenever the highest level cascades.
+        if (level == kNumLevels - 1) {
+            reinsert(index);
+            index = overflow_head_;
+            overflow_head_ = kNone;
+        }
+
+        reinsert(index);
+    }
+
+    void reinsert(uint32_t index) {
+        while (index != kNone) {
+            const auto next = nodes_[index].next;
+            insert(index);
+            index = next;
+        }
+    }
+};
+
+}  // namespace rdk
@@ -0,0 +1,97 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/detail/CaseFolding.h"
+
+#include <catch2/catch_all.hpp>
+#include <cctype>
+#include <random>
+
+namespace {
+
+std::string to_lower_reference(std::string str) {
+    for (auto& c : str) {
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+        }
+    }
+    return str;
+}
+
+std::vector<rdk::detail::SimdLevel> supported_levels() {
+    std::vector<rdk::detail::SimdLevel> levels {rdk::detail::SimdLevel::kScalar};
+    if (rdk::detail::simd_level() >= rdk::detail::SimdLevel::kSse2) {
+        levels.push_back(rdk::detail::SimdLevel::kSse2);
+    }
+    if (rdk::detail::simd_level() >= rdk::detail::SimdLevel::kAvx2) {
+        levels.push_back(rdk::detail::SimdLevel::kAvx2);
+    }
+    return levels;
+}
+
+}  // namespace
+
+TEST_CASE("CaseFolding", "[CaseFolding]") {
+    const auto levels = supported_levels();
+
+    SECTION("Folding all byte values") {
+        for (int c = 0; c < 256; ++c) {
+            const auto character = static_cast<char>(c);
+            const auto expected = to_lower_reference(std::string(1, character))[0];
+            REQUIRE(rdk::detail::to_ascii_lower(character) == expected);
+
+            // The same character in every position of a word.
+            uint64_t word = 0;
+            std::memset(&word, c, sizeof(word));
+            uint64_t expected_word = 0;
+            std::memset(&expected_word, static_cast<unsigned char>(expected), sizeof(expected_word));
+            REQUIRE(rdk::detail::to_ascii_lower(word) == expected_word);
+        }
+    }
+
+    SECTION("Randomized against the reference") {
+        std::mt19937 rng(42);
+        const std::string_view alphabet("aAbBzZ@[`{\x80\xc1\xe1", 13);
+
+        for (int iteration = 0; iteration < 2000; ++iteration) {
+            std::string haystack(rng() % 200, ' ');
+            for (auto& c : haystack) {
+                c = alphabet[rng() % alphabet.size()];
+            }
+            std::string needle(1 + rng() % 40, ' ');
+            for (auto& c : needle) {
+                c = alphabet[rng() % alphabet.size()];
+            }
+            if (rng() % 2 == 0 && needle.size() <= haystack.size()) {
+                // Make sure there is at least one occurrence, with randomized case.
+                needle = haystack.substr(rng() % (haystack.size() - needle.size() + 1), needle.size());
+                for (auto& c : needle) {
+                    if (rng() % 2 == 0 && c >= 'a' && c <= 'z') {
+                        c = static_cast<char>(c - ('a' - 'A'));
+                    }
+                }
+            }
+
+            const auto lower_haystack = to_lower_reference(haystack);
+            const auto lower_needle = to_lower_reference(needle);
+            const auto expected_find = lower_haystack.find(lower_needle);
+            const auto other = needle.size() <= haystack.size() ? haystack.substr(0, needle.size()) : haystack;
+            const auto expected_equal = to_lower_reference(other) == lower_needle;
+
+            for (const auto level : levels) {
+                REQUIRE(rdk::detail::ifind_runtime(haystack, needle, level) == expected_find);
+                REQUIRE(
+                    (other.size() == needle.size()
+                     && rdk::detail::iequals_runtime(other.data(), needle.data(), needle.size(), level))
+                    == expected_equal
+                );
+            }
+
+            if (expected_equal) {
+                REQUIRE(rdk::detail::ihash_runtime(other) == rdk::detail::ihash_runtime(needle));
+            }
+        }
+    }
+}
@@ -0,0 +1,64 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/detail/FlatPointerMap.h"
+
+#include <catch2/catch_all.hpp>
+#include <map>
+#include <random>
+#include <vector>
+
+TEST_CASE("FlatPointerMap", "[FlatPointerMap]") {
+    rdk::detail::FlatPointerMap<int, uint32_t> map;
+    int a = 0;
+    int b = 0;
+
+    REQUIRE(map.find(&a) == nullptr);
+    REQUIRE_FALSE(map.erase(&a));
+
+    auto [value, inserted] = map.try_emplace(&a, 1);
+    REQUIRE(inserted);
+    REQUIRE(*value == 1);
+
+    auto [existing, inserted_again] = map.try_emplace(&a, 2);
+    REQUIRE_FALSE(inserted_again);
+    REQUIRE(*existing == 1);
+
+    map.try_emplace(&b, 3);
+    REQUIRE(map.size() == 2);
+    REQUIRE(*map.find(&b) == 3);
+
+    REQUIRE(map.erase(&a));
+    REQUIRE(map.find(&a) == nullptr);
+    REQUIRE(*map.find(&b) == 3);
+    REQUIRE(map.size() == 1);
+}
+
+TEST_CASE("FlatPointerMap against std::map", "[FlatPointerMap]") {
+    std::vector<int> keys(2000);
+    rdk::detail::FlatPointerMap<int, uint32_t> map;
+    std::map<int*, uint32_t> reference;
+    std::mt19937 random(42);
+
+    for (int i = 0; i < 100000; ++i) {
+        auto* key = &keys[random() % keys.size()];
+        if (random() % 3 == 0) {
+            REQUIRE(map.erase(key) == (reference.erase(key) == 1));
+        } else {
+            const auto value = static_cast<uint32_t>(i);
+            REQUIRE(map.try_emplace(key, value).second == reference.try_emplace(key, value).second);
+        }
+        REQUIRE(map.size() == reference.size());
+    }
+
+    for (auto& key : keys) {
+        const auto it = reference.find(&key);
+        const auto* value = map.find(&key);
+        REQUIRE((value == nullptr) == (it == reference.end()));
+        if (value != nullptr) {
+            REQUIRE(*value == it->second);
+        }
+    }
+}
@@ -0,0 +1,103 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/detail/StringSearch.h"
+
+#include <catch2/catch_all.hpp>
+#include <random>
+
+namespace {
+
+/**
+ * The reference implementation, which restarts the search after every occurrence.
+ */
+size_t find_nth_reference(const std::string_view haystack, const std::string_view needle, const size_t nth) {
+    size_t pos = std::string_view::npos;
+    for (size_t i = 0; i < nth; ++i) {
+        pos = haystack.find(needle, pos + 1);
+        if (pos == std::string_view::npos)
+            return pos;
+    }
+    return pos;
+}
+
+std::vector<rdk::detail::SimdLevel> supported_levels() {
+    std::vector<rdk::detail::SimdLevel> levels {rdk::detail::SimdLevel::kScalar};
+    if (rdk::detail::simd_level() >= rdk::detail::SimdLevel::kSse2) {
+        levels.push_back(rdk::detail::SimdLevel::kSse2);
+    }
+    if (rdk::detail::simd_level() >= rdk::detail::SimdLevel::kAvx2) {
+        levels.push_back(rdk::detail::SimdLevel::kAvx2);
+    }
+    return levels;
+}
+
+}  // namespace
+
+TEST_CASE("StringSearch", "[StringSearch]") {
+    const auto levels = supported_levels();
+
+    SECTION("Basic") {
+        const std::string haystack =
+            "v=0\r\no=- 1 1 IN IP4 192.168.1.1\r\ns=Stream\r\nc=IN IP4 239.1.1.1/32\r\nt=0 0\r\n";
+
+        for (const auto level : levels) {
+            REQUIRE(rdk::detail::find_nth(haystack, "\r\n", 1, level) == 3);
+            REQUIRE(rdk::detail::find_nth(haystack, "\r\n", 3, level) == haystack.find("\r\nc="));
+            REQUIRE(rdk::detail::find_nth(haystack, "\r\n", 6, level) == std::string_view::npos);
+            REQUIRE(rdk::detail::find_nth(haystack, "IN IP4", 2, level) == haystack.find("IN IP4 239"));
+            REQUIRE(rdk::detail::find_nth(haystack, "IN IP6", 1, level) == std::string_view::npos);
+            REQUIRE(rdk::detail::find_nth(haystack, "\r\n", 0, level) == std::string_view::npos);
+        }
+    }
+
+    SECTION("Overlapping occurrences") {
+        const std::string haystack(100, 'a');
+
+        for (const auto level : levels) {
+            REQUIRE(rdk::detail::find_nth(haystack, "aaa", 1, level) == 0);
+            REQUIRE(rdk::detail::find_nth(haystack, "aaa", 50, level) == 49);
+            REQUIRE(rdk::detail::find_nth(haystack, "aaa", 98, level) == 97);
+            REQUIRE(rdk::detail::find_nth(haystack, "aaa", 99, level) == std::string_view::npos);
+        }
+    }
+
+    SECTION("Empty needle and haystack") {
+        for (const auto level : levels) {
+            REQUIRE(rdk::detail::find_nth("abc", "", 1, level) == 0);
+            REQUIRE(rdk::detail::find_nth("abc", "", 4, level) == 3);
+            REQUIRE(rdk::detail::find_nth("abc", "", 5, level) == std::string_view::npos);
+            REQUIRE(rdk::detail::find_nth("", "a", 1, level) == std::string_view::npos);
+            REQUIRE(rdk::detail::find_nth("", "", 1, level) == 0);
+        }
+    }
+
+    SECTION("Randomized against the reference") {
+        std::mt19937 rng(42);
+
+        for (int iteration = 0; iteration < 2000; ++iteration) {
+            // A small alphabet, so there are many partial and full matches.
+            std::string haystack(rng() % 300, ' ');
+            for (auto& c : haystack) {
+                c = "ab\0\xff"[rng() % 4];
+            }
+            std::string needle(1 + rng() % 40, ' ');
+            for (auto& c : needle) {
+                c = "ab\0\xff"[rng() % 4];
+            }
+            if (rng() % 2 == 0 && needle.size() <= haystack.size()) {
+                // Make sure there is at least one occurrence.
+                needle = haystack.substr(rng() % (haystack.size() - needle.size() + 1), needle.size());
+            }
+
+            for (size_t nth = 1; nth <= 4; ++nth) {
+                const auto expected = find_nth_reference(haystack, needle, nth);
+                for (const auto level : levels) {
+                    REQUIRE(rdk::detail::find_nth(haystack, needle, nth, level) == expected);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,55 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/metrics/Counter.h"
+#include "rdk/metrics/Gauge.h"
+
+#include <catch2/catch_all.hpp>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Counter", "[metrics]") {
+    rdk::metrics::Counter counter;
+    REQUIRE(counter.value() == 0);
+    counter.increment();
+    counter.add(41);
+    REQUIRE(counter.value() == 42);
+}
+
+TEST_CASE("Counter from multiple threads", "[metrics]") {
+    rdk::metrics::Counter counter;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < 10000; ++i) {
+                counter.increment();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(counter.value() == 40000);
+}
+
+TEST_CASE("Gauge", "[metrics]") {
+    rdk::metrics::Gauge gauge;
+    REQUIRE(gauge.value() == 0);
+
+    gauge.set(10);
+    gauge.increment();
+    gauge.add(-20);
+    gauge.decrement();
+    REQUIRE(gauge.value() == -10);
+
+    gauge.set(0);
+    {
+        const auto a = gauge.track();
+        const auto b = gauge.track();
+        REQUIRE(gauge.value() == 2);
+        REQUIRE(b.previous_value() == 1);
+    }
+    REQUIRE(gauge.value() == 0);
+}
@@ -0,0 +1,146 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/metrics/Histogram.h"
+#include "rdk/metrics/ScopedTimer.h"
+
+#include <catch2/catch_all.hpp>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+using rdk::metrics::Histogram;
+
+TEST_CASE("Histogram bucket bounds", "[metrics]") {
+    SECTION("Small values have a bucket of their own") {
+        for (uint64_t value = 0; value < Histogram::kSubBucketCount * 2; ++value) {
+            const auto index = Histogram::bucket_index(value);
+            REQUIRE(index == value);
+            REQUIRE(Histogram::bucket_lower_bound(index) == value);
+            REQUIRE(Histogram::bucket_upper_bound(index) == value);
+        }
+    }
+
+    SECTION("Buckets are contiguous") {
+        for (size_t i = 1; i < Histogram::kBucketCount; ++i) {
+            REQUIRE(Histogram::bucket_lower_bound(i) == Histogram::bucket_upper_bound(i - 1) + 1);
+        }
+        REQUIRE(Histogram::bucket_lower_bound(0) == 0);
+        REQUIRE(Histogram::bucket_upper_bound(Histogram::kBucketCount - 1) == std::numeric_limits<uint64_t>::max());
+    }
+
+    SECTION("Values are in their bucket, within the relative error") {
+        std::mt19937_64 random(42);
+        for (int i = 0; i < 100000; ++i) {
+            const auto value = random() >> (random() % 64);
+            const auto index = Histogram::bucket_index(value);
+            REQUIRE(index < Histogram::kBucketCount);
+            REQUIRE(Histogram::bucket_lower_bound(index) <= value);
+            REQUIRE(value <= Histogram::bucket_upper_bound(index));
+            const auto width = Histogram::bucket_upper_bound(index) - Histogram::bucket_lower_bound(index);
+            REQUIRE(static_cast<double>(width) <= static_cast<double>(value) / Histogram::kSubBucketCount);
+        }
+    }
+}
+
+TEST_CASE("Histogram statistics", "[metrics]") {
+    Histogram histogram;
+
+    SECTION("Empty") {
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 0);
+        REQUIRE(snapshot.sum() == 0);
+        REQUIRE(snapshot.mean() == 0.0);
+        REQUIRE(snapshot.value_at_quantile(0.5) == 0);
+    }
+
+    SECTION("Quantiles") {
+        for (uint64_t value = 1; value <= 1000; ++value) {
+            histogram.record(value * 1000);
+        }
+
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 1000);
+        REQUIRE(snapshot.sum() == 500500000);
+        REQUIRE(snapshot.mean() == 500500.0);
+
+        const auto check = [&](const double quantile, const uint64_t expected) {
+            const auto value = snapshot.value_at_quantile(quantile);
+            REQUIRE(value >= expected);
+            REQUIRE(static_cast<double>(value) <= static_cast<double>(expected) * 1.0625);
+        };
+        check(0.0, 1000);
+        check(0.5, 500000);
+        check(0.99, 990000);
+        check(1.0, 1000000);
+    }
+
+    SECTION("Buckets") {
+        histogram.record(3);
+        histogram.record(3);
+        histogram.record(1000);
+        REQUIRE(histogram.bucket(3) == 2);
+        REQUIRE(histogram.bucket(Histogram::bucket_index(1000)) == 1);
+        REQUIRE(histogram.snapshot().bucket(3) == 2);
+        REQUIRE(histogram.sum() == 1006);
+    }
+}
+
+TEST_CASE("Histogram from multiple threads", "[metrics]") {
+    Histogram histogram;
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&histogram, t] {
+            for (uint64_t i = 0; i < 10000; ++i) {
+                histogram.record(t * 10000 + i);
+            }
+        });
+    }
+
+    // Snapshots are taken while recording.
+    for (int i = 0; i < 10; ++i) {
+        REQUIRE(histogram.snapshot().count() <= 40000);
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto snapshot = histogram.snapshot();
+    REQUIRE(snapshot.count() == 40000);
+    REQUIRE(snapshot.sum() == 40000ull * 39999 / 2);
+}
+
+TEST_CASE("ScopedTimer", "[metrics]") {
+    Histogram histogram;
+
+    SECTION("Records on destruction") {
+        {
+            const rdk::metrics::ScopedTimer timer(histogram);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        const auto snapshot = histogram.snapshot();
+        REQUIRE(snapshot.count() == 1);
+        REQUIRE(snapshot.sum() >= 1'000'000);
+    }
+
+    SECTION("Stop records once") {
+        {
+            rdk::metrics::ScopedTimer timer(histogram);
+            timer.stop();
+            timer.stop();
+        }
+        REQUIRE(histogram.snapshot().count() == 1);
+    }
+
+    SECTION("Cancel") {
+        {
+            rdk::metrics::ScopedTimer timer(histogram);
+            timer.cancel();
+        }
+        REQUIRE(histogram.snapshot().count() == 0);
+    }
+}
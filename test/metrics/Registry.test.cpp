@@ -0,0 +1,126 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/metrics/Registry.h"
+
+#include <atomic>
+#include <catch2/catch_all.hpp>
+#include <thread>
+
+using rdk::metrics::Registry;
+
+TEST_CASE("Registry returns the same metric for the same name", "[metrics]") {
+    Registry registry;
+    auto& a = registry.counter("requests_total", "Number of requests");
+    auto& b = registry.counter("requests_total");
+    REQUIRE(&a == &b);
+    REQUIRE(&registry.gauge("in_flight") == &registry.gauge("in_flight"));
+    REQUIRE(&registry.histogram("latency") != &registry.histogram("other_latency"));
+}
+
+TEST_CASE("Registry metric names", "[metrics]") {
+    REQUIRE(Registry::is_valid_name("requests_total"));
+    REQUIRE(Registry::is_valid_name("rdk:requests_2xx"));
+    REQUIRE(Registry::is_valid_name("_private"));
+    REQUIRE_FALSE(Registry::is_valid_name(""));
+    REQUIRE_FALSE(Registry::is_valid_name("2xx"));
+    REQUIRE_FALSE(Registry::is_valid_name("requests-total"));
+    REQUIRE_FALSE(Registry::is_valid_name("requests total"));
+}
+
+TEST_CASE("Registry Prometheus export", "[metrics]") {
+    Registry registry;
+    registry.counter("requests_total", "Number of requests.\nIncluding failed ones \\o/").add(42);
+    registry.gauge("in_flight").set(-3);
+    auto& latency = registry.histogram("latency_nanoseconds", "Request latency", {10, 1000, 100000});
+    latency.record(5);
+    latency.record(5);
+    latency.record(1000);
+
+    const auto* expected =
+        "# HELP requests_total Number of requests.\\nIncluding failed ones \\\\o/\n"
+        "# TYPE requests_total counter\n"
+        "requests_total 42\n"
+        "# TYPE in_flight gauge\n"
+        "in_flight -3\n"
+        "# HELP latency_nanoseconds Request latency\n"
+        "# TYPE latency_nanoseconds histogram\n"
+        "latency_nanoseconds_bucket{le=\"10\"} 2\n"
+        "latency_nanoseconds_bucket{le=\"1023\"} 3\n"
+        "latency_nanoseconds_bucket{le=\"102399\"} 3\n"
+        "latency_nanoseconds_bucket{le=\"+Inf\"} 3\n"
+        "latency_nanoseconds_sum 1010\n"
+        "latency_nanoseconds_count 3\n";
+
+    REQUIRE(registry.write_prometheus() == expected);
+
+    SECTION("Into a buffer") {
+        char buffer[1024];
+        const auto length = registry.write_prometheus(buffer, sizeof(buffer));
+        REQUIRE(std::string_view(buffer, length) == expected);
+    }
+
+    SECTION("Into a buffer which is too small") {
+        char buffer[16] {};
+        const auto length = registry.write_prometheus(buffer, sizeof(buffer));
+        REQUIRE(length == std::string_view(expected).size());
+        REQUIRE(std::string_view(buffer, sizeof(buffer)) == std::string_view(expected).substr(0, sizeof(buffer)));
+    }
+}
+
+TEST_CASE("Registry exports the same histogram buckets on every scrape", "[metrics]") {
+    Registry registry;
+    auto& histogram = registry.histogram("values");
+
+    const auto empty = registry.write_prometheus();
+    REQUIRE(empty.find("values_bucket{le=\"0\"} 0\n") != std::string::npos);
+    REQUIRE(empty.find("values_bucket{le=\"3\"} 0\n") != std::string::npos);
+    REQUIRE(empty.find("values_bucket{le=\"1023\"} 0\n") != std::string::npos);
+    REQUIRE(empty.find("values_bucket{le=\"4611686018427387903\"} 0\n") != std::string::npos);
+
+    histogram.record(5);
+    histogram.record(1000);
+    const auto filled = registry.write_prometheus();
+    REQUIRE(filled.find("values_bucket{le=\"3\"} 0\n") != std::string::npos);
+    REQUIRE(filled.find("values_bucket{le=\"15\"} 1\n") != std::string::npos);
+    REQUIRE(filled.find("values_bucket{le=\"1023\"} 2\n") != std::string::npos);
+
+    const auto count_buckets = [](const std::string& text) {
+        size_t count = 0;
+        for (auto pos = text.find("_bucket{"); pos != std::string::npos; pos = text.find("_bucket{", pos + 1)) {
+            count++;
+        }
+        return count;
+    };
+    REQUIRE(count_buckets(empty) == 33);  // Every power of 4, and +Inf.
+    REQUIRE(count_buckets(filled) == count_buckets(empty));
+
+    SECTION("Boundaries which round up to the same bucket are exported once") {
+        registry.histogram("rounded", {}, {1000, 1001, 1023});
+        const auto text = registry.write_prometheus();
+        REQUIRE(text.find("rounded_bucket{le=\"1023\"} 0\nrounded_bucket{le=\"+Inf\"} 0\n") != std::string::npos);
+    }
+}
+
+TEST_CASE("Registry exports while metrics are updated", "[metrics]") {
+    Registry registry;
+    auto& counter = registry.counter("events_total");
+    auto& histogram = registry.histogram("values");
+
+    std::atomic<bool> done {false};
+    std::thread writer([&] {
+        for (uint64_t i = 0; !done.load(); ++i) {
+            counter.increment();
+            histogram.record(i);
+        }
+    });
+
+    for (int i = 0; i < 100; ++i) {
+        REQUIRE(registry.write_prometheus().find("# TYPE events_total counter\n") != std::string::npos);
+    }
+
+    done.store(true);
+    writer.join();
+}
@@ -0,0 +1,159 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/Arena.h"
+#include "rdk/util/Leak.h"
+
+#include <algorithm>
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Tracked {
+    explicit Tracked(std::vector<int>& destroyed, const int id) : destroyed_(destroyed), id_(id) {}
+
+    ~Tracked() {
+        destroyed_.push_back(id_);
+    }
+
+    std::vector<int>& destroyed_;
+    int id_;
+};
+
+struct alignas(64) OverAligned {
+    char data[64];
+};
+
+}  // namespace
+
+TEST_CASE("Arena allocate", "[Arena]") {
+    rdk::Arena arena(256);
+    REQUIRE(arena.bytes_reserved() == 0);
+
+    SECTION("Alignment") {
+        for (const size_t alignment : {1, 2, 4, 8, 16, 32, 64, 128}) {
+            auto* p = arena.allocate(3, alignment);
+            REQUIRE(reinterpret_cast<uintptr_t>(p) % alignment == 0);
+        }
+        REQUIRE(reinterpret_cast<uintptr_t>(arena.make<OverAligned>()) % 64 == 0);
+    }
+
+    SECTION("Consecutive allocations are contiguous") {
+        auto* a = static_cast<char*>(arena.allocate(16, 1));
+        auto* b = static_cast<char*>(arena.allocate(16, 1));
+        REQUIRE(b == a + 16);
+        REQUIRE(arena.bytes_allocated() == 32);
+    }
+
+    SECTION("Grows in chunks") {
+        std::vector<int*> values;
+        for (int i = 0; i < 10000; ++i) {
+            values.push_back(arena.make<int>(i));
+        }
+        for (int i = 0; i < 10000; ++i) {
+            REQUIRE(*values[static_cast<size_t>(i)] == i);
+        }
+        REQUIRE(arena.bytes_allocated() == 10000 * sizeof(int));
+        REQUIRE(arena.bytes_reserved() >= arena.bytes_allocated());
+        REQUIRE(arena.bytes_reserved() < arena.bytes_allocated() * 4);
+    }
+
+    SECTION("Allocations larger than a chunk") {
+        auto* big = static_cast<char*>(arena.allocate(1024 * 1024));
+        std::fill(big, big + 1024 * 1024, 'x');
+        auto* small = arena.make<int>(42);
+        REQUIRE(*small == 42);
+        REQUIRE(big[1024 * 1024 - 1] == 'x');
+    }
+
+    SECTION("Zero sized allocations") {
+        REQUIRE(arena.allocate(0) != nullptr);
+    }
+
+    SECTION("Allocations which are too large throw instead of wrapping around") {
+        auto* first = static_cast<int*>(arena.allocate(sizeof(int)));
+        const auto bytes_allocated = arena.bytes_allocated();
+
+        REQUIRE_THROWS_AS(arena.allocate(SIZE_MAX), std::bad_alloc);
+        REQUIRE_THROWS_AS(arena.allocate(SIZE_MAX - 16), std::bad_alloc);
+        REQUIRE_THROWS_AS(arena.allocate(SIZE_MAX - 64, 64), std::bad_alloc);
+        REQUIRE(arena.bytes_allocated() == bytes_allocated);
+
+        // The arena is still usable.
+        auto* second = static_cast<int*>(arena.allocate(sizeof(int)));
+        REQUIRE(second > first);
+    }
+}
+
+TEST_CASE("Arena make and release", "[Arena]") {
+    std::vector<int> destroyed;
+
+    SECTION("Objects are destroyed in reverse order") {
+        {
+            rdk::Arena arena;
+            arena.make<Tracked>(destroyed, 1);
+            arena.make<Tracked>(destroyed, 2);
+            arena.make<Tracked>(destroyed, 3);
+            REQUIRE(destroyed.empty());
+
+            arena.release();
+            REQUIRE(destroyed == std::vector<int> {3, 2, 1});
+            REQUIRE(arena.bytes_allocated() == 0);
+            REQUIRE(arena.bytes_reserved() == 0);
+
+            // The arena can be used again.
+            arena.make<Tracked>(destroyed, 4);
+        }
+        REQUIRE(destroyed == std::vector<int> {3, 2, 1, 4});
+    }
+
+    SECTION("Leaked objects are not destroyed") {
+        {
+            rdk::Arena arena;
+            arena.leak<Tracked>(destroyed, 1);
+            arena.make<Tracked>(destroyed, 2);
+        }
+        REQUIRE(destroyed == std::vector<int> {2});
+    }
+
+    SECTION("Objects owning memory") {
+        rdk::Arena arena;
+        auto* str = arena.make<std::string>(1000, 'a');
+        auto* vec = arena.make<std::vector<int>>(1000, 1);
+        REQUIRE(str->size() == 1000);
+        REQUIRE(vec->size() == 1000);
+    }
+}
+
+TEST_CASE("Arena leaked as a whole", "[Arena]") {
+    static rdk::Leak<rdk::Arena> arena;
+    static auto* str = arena.get()->leak<std::string>("outlives static destruction");
+    REQUIRE(*str == "outlives static destruction");
+}
+
+#if RDK_HAS_MEMORY_RESOURCE
+
+TEST_CASE("ArenaResource", "[Arena]") {
+    rdk::Arena arena;
+    rdk::ArenaResource resource(arena);
+    REQUIRE(&resource.arena() == &arena);
+
+    std::pmr::vector<std::pmr::string> strings(&resource);
+    for (int i = 0; i < 1000; ++i) {
+        strings.emplace_back("a string which is too long for the small string optimization");
+    }
+    REQUIRE(strings.size() == 1000);
+    REQUIRE(strings.back().get_allocator().resource() == &resource);
+    REQUIRE(arena.bytes_allocated() > 1000 * 60);
+
+    rdk::Arena other_arena;
+    rdk::ArenaResource other(other_arena);
+    REQUIRE(resource.is_equal(resource));
+    REQUIRE_FALSE(resource.is_equal(other));
+}
+
+#endif
@@ -0,0 +1,113 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/AsyncSubscriberList.h"
+
+#include <catch2/catch_all.hpp>
+#include <thread>
+
+namespace {
+
+struct LevelEvent {
+    int channel;
+    float level;
+};
+
+struct LevelSubscriber {
+    std::vector<int> channels;
+
+    void on_level(const LevelEvent& event) {
+        channels.push_back(event.channel);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("AsyncSubscriberList", "[AsyncSubscriberList]") {
+    rdk::AsyncSubscriberList<LevelSubscriber, LevelEvent, 4> list;
+
+    LevelSubscriber a;
+    LevelSubscriber b;
+    auto subscription_a = list.add(&a);
+    auto subscription_b = list.add(&b);
+
+    SECTION("Events are dispatched to all subscribers") {
+        REQUIRE(list.post({1, 0.5f}));
+        REQUIRE(list.post({2, 0.25f}));
+
+        REQUIRE(a.channels.empty());
+        REQUIRE(list.dispatch_member(&LevelSubscriber::on_level) == 2);
+        REQUIRE(a.channels == std::vector<int> {1, 2});
+        REQUIRE(b.channels == std::vector<int> {1, 2});
+
+        REQUIRE(list.dispatch_member(&LevelSubscriber::on_level) == 0);
+    }
+
+    SECTION("Overflow is counted") {
+        for (int i = 0; i < 6; ++i) {
+            list.post({i, 0.f});
+        }
+
+        REQUIRE(list.get_num_dropped() == 2);
+        REQUIRE(list.get_high_water_mark() == 4);
+
+        size_t num_calls = 0;
+        REQUIRE(list.dispatch([&num_calls](LevelSubscriber&, const LevelEvent&) { num_calls++; }) == 4);
+        REQUIRE(num_calls == 8);
+    }
+
+    SECTION("Unsubscribed subscribers don't receive events") {
+        list.post({1, 0.f});
+        subscription_a.reset();
+        list.dispatch_member(&LevelSubscriber::on_level);
+
+        REQUIRE(a.channels.empty());
+        REQUIRE(b.channels == std::vector<int> {1});
+    }
+
+    SECTION("Dispatching from a subscriber does nothing") {
+        list.post({1, 0.f});
+        list.post({2, 0.f});
+
+        size_t num_nested = 0;
+        list.dispatch([&](LevelSubscriber& subscriber, const LevelEvent& event) {
+            subscriber.on_level(event);
+            num_nested += list.dispatch_member(&LevelSubscriber::on_level);
+        });
+
+        REQUIRE(num_nested == 0);
+        REQUIRE(a.channels == std::vector<int> {1, 2});
+        REQUIRE(b.channels == std::vector<int> {1, 2});
+        REQUIRE(list.dispatch_member(&LevelSubscriber::on_level) == 0);
+    }
+
+    SECTION("Events from another thread") {
+        constexpr int kNumEvents = 10'000;
+        rdk::AsyncSubscriberList<LevelSubscriber, LevelEvent, 64> cross_thread_list;
+        LevelSubscriber subscriber;
+        auto subscription = cross_thread_list.add(&subscriber);
+
+        std::thread producer([&cross_thread_list] {
+            for (int i = 0; i < kNumEvents; ++i) {
+                while (!cross_thread_list.post({i, 0.f})) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        while (subscriber.channels.size() < kNumEvents) {
+            if (cross_thread_list.dispatch_member(&LevelSubscriber::on_level) == 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        producer.join();
+
+        REQUIRE(subscriber.channels.size() == kNumEvents);
+        REQUIRE(subscriber.channels.front() == 0);
+        REQUIRE(subscriber.channels.back() == kNumEvents - 1);
+        REQUIRE(cross_thread_list.get_high_water_mark() <= 64);
+    }
+}
@@ -0,0 +1,174 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/CoalescingSubscriberList.h"
+
+#include <catch2/catch_all.hpp>
+#include <stdexcept>
+
+namespace {
+
+enum class Property { volume, pan, mute };
+
+struct PropertySubscriber {
+    std::vector<Property> changes;
+    std::function<void()> on_change;
+
+    void on_property_changed(const Property property) {
+        changes.push_back(property);
+        if (on_change) {
+            on_change();
+        }
+    }
+};
+
+}  // namespace
+
+TEST_CASE("CoalescingSubscriberList", "[CoalescingSubscriberList]") {
+    rdk::CoalescingSubscriberList<PropertySubscriber, Property> list;
+
+    PropertySubscriber a;
+    PropertySubscriber b;
+    auto subscription_a = list.add(&a);
+    auto subscription_b = list.add(&b);
+
+    SECTION("Redundant notifications are coalesced") {
+        REQUIRE(list.post(Property::volume));
+        REQUIRE_FALSE(list.post(Property::volume));
+        REQUIRE(list.post(Property::pan));
+        REQUIRE_FALSE(list.post(Property::volume));
+        REQUIRE(list.get_num_pending() == 2);
+
+        list.flush_member(&PropertySubscriber::on_property_changed);
+
+        REQUIRE(a.changes == std::vector<Property> {Property::volume, Property::pan});
+        REQUIRE(b.changes == std::vector<Property> {Property::volume, Property::pan});
+        REQUIRE(list.get_num_pending() == 0);
+
+        // Nothing is delivered when nothing was posted.
+        list.flush_member(&PropertySubscriber::on_property_changed);
+        REQUIRE(a.changes.size() == 2);
+    }
+
+    SECTION("Flush with callback") {
+        list.post(Property::mute);
+
+        size_t num_calls = 0;
+        list.flush([&num_calls](PropertySubscriber&, const Property property) {
+            REQUIRE(property == Property::mute);
+            num_calls++;
+        });
+
+        REQUIRE(num_calls == 2);
+    }
+
+    SECTION("Subscribers which unsubscribe before the flush are not called") {
+        list.post(Property::volume);
+        subscription_a.reset();
+
+        list.flush_member(&PropertySubscriber::on_property_changed);
+
+        REQUIRE(a.changes.empty());
+        REQUIRE(b.changes == std::vector<Property> {Property::volume});
+    }
+
+    SECTION("Subscribers which unsubscribe during the flush are not called anymore") {
+        a.on_change = [&subscription_b] { subscription_b.reset(); };
+
+        list.post(Property::volume);
+        list.post(Property::pan);
+        list.flush_member(&PropertySubscriber::on_property_changed);
+
+        REQUIRE(a.changes == std::vector<Property> {Property::volume, Property::pan});
+        REQUIRE(b.changes.empty());
+    }
+
+    SECTION("Subscribers which unsubscribe themselves during the first key don't receive the other keys") {
+        b.on_change = [&subscription_b] { subscription_b.reset(); };
+
+        list.post(Property::volume);
+        list.post(Property::pan);
+        list.post(Property::mute);
+        list.flush_member(&PropertySubscriber::on_property_changed);
+
+        REQUIRE(a.changes == std::vector<Property> {Property::volume, Property::pan, Property::mute});
+        REQUIRE(b.changes == std::vector<Property> {Property::volume});
+    }
+
+    SECTION("Notifications posted during the flush are delivered on the next flush") {
+        a.on_change = [&list] { list.post(Property::mute); };
+
+        list.post(Property::volume);
+        list.flush_member(&PropertySubscriber::on_property_changed);
+        REQUIRE(a.changes == std::vector<Property> {Property::volume});
+        REQUIRE(list.get_num_pending() == 1);
+
+        a.on_change = nullptr;
+        list.flush_member(&PropertySubscriber::on_property_changed);
+        REQUIRE(a.changes == std::vector<Property> {Property::volume, Property::mute});
+        REQUIRE(b.changes == std::vector<Property> {Property::volume, Property::mute});
+    }
+
+    SECTION("Each subscriber receives all keys before the next subscriber is called") {
+        std::vector<std::pair<PropertySubscriber*, Property>> calls;
+        list.post(Property::volume);
+        list.post(Property::pan);
+        list.flush([&calls](PropertySubscriber& subscriber, const Property property) {
+            calls.emplace_back(&subscriber, property);
+        });
+
+        REQUIRE(
+            calls
+            == std::vector<std::pair<PropertySubscriber*, Property>> {
+                {&a, Property::volume},
+                {&a, Property::pan},
+                {&b, Property::volume},
+                {&b, Property::pan},
+            }
+        );
+    }
+
+    SECTION("A throwing callback doesn't leave the list flushing") {
+        list.post(Property::volume);
+        REQUIRE_THROWS(list.flush([](PropertySubscriber&, Property) {
+            throw std::runtime_error("Failed");
+        }));
+
+        list.post(Property::pan);
+        list.flush_member(&PropertySubscriber::on_property_changed);
+        REQUIRE(a.changes == std::vector<Property> {Property::pan});
+        REQUIRE(list.get_num_pending() == 0);
+    }
+
+    SECTION("Clear drops pending notifications") {
+        list.post(Property::volume);
+        list.clear();
+        list.flush_member(&PropertySubscriber::on_property_changed);
+        REQUIRE(a.changes.empty());
+    }
+}
+
+TEST_CASE("CoalescingSubscriberList with many keys", "[CoalescingSubscriberList]") {
+    rdk::CoalescingSubscriberList<std::vector<int>, int> list;
+    std::vector<int> received;
+    auto subscription = list.add(&received);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int key = 0; key < 10'000; ++key) {
+            REQUIRE(list.post(key) == (round == 0));
+        }
+    }
+    REQUIRE(list.get_num_pending() == 10'000);
+
+    list.flush([](std::vector<int>& subscriber, const int key) {
+        subscriber.push_back(key);
+    });
+    REQUIRE(received.size() == 10'000);
+    REQUIRE(received.front() == 0);
+    REQUIRE(received.back() == 9'999);
+
+    // Keys can be posted again after the flush.
+    REQUIRE(list.post(42));
+}
@@ -0,0 +1,210 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ConcurrentSubscriberList.h"
+
+#include <catch2/catch_all.hpp>
+#include <chrono>
+#include <thread>
+
+namespace {
+
+struct CountingSubscriber {
+    std::atomic<int> num_calls {0};
+    std::atomic<bool> unsubscribed {false};
+
+    void callback() {
+        num_calls.fetch_add(1);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("ConcurrentSubscriberList", "[ConcurrentSubscriberList]") {
+    rdk::ConcurrentSubscriberList<CountingSubscriber> subscribers;
+
+    CountingSubscriber a;
+    CountingSubscriber b;
+
+    REQUIRE(subscribers.get_num_subscribers() == 0);
+
+    SECTION("Add and call") {
+        auto subscription_a = subscribers.add(&a);
+        auto subscription_b = subscribers.add(&b);
+
+        REQUIRE(subscribers.get_num_subscribers() == 2);
+        REQUIRE(subscribers.has_subscriber(&a));
+        REQUIRE(subscribers.has_subscriber(&b));
+
+        subscribers.call([](CountingSubscriber& s) { s.callback(); });
+        REQUIRE(a.num_calls == 1);
+        REQUIRE(b.num_calls == 1);
+
+        subscribers.call([](CountingSubscriber& s) { s.callback(); }, &a);
+        REQUIRE(a.num_calls == 1);
+        REQUIRE(b.num_calls == 2);
+
+        subscribers.call_member(&CountingSubscriber::callback);
+        REQUIRE(a.num_calls == 2);
+        REQUIRE(b.num_calls == 3);
+    }
+
+    SECTION("Unsubscribe on destruction") {
+        {
+            auto subscription = subscribers.add(&a);
+            REQUIRE(subscribers.get_num_subscribers() == 1);
+        }
+        REQUIRE(subscribers.get_num_subscribers() == 0);
+
+        subscribers.call([](CountingSubscriber& s) { s.callback(); });
+        REQUIRE(a.num_calls == 0);
+    }
+
+    SECTION("Double subscribing") {
+        auto first = subscribers.add(&a);
+        {
+            auto second = subscribers.add(&a);
+            REQUIRE(subscribers.get_num_subscribers() == 1);
+
+            subscribers.call([](CountingSubscriber& s) { s.callback(); });
+            REQUIRE(a.num_calls == 1);
+        }
+        REQUIRE(subscribers.get_num_subscribers() == 1);
+        first.reset();
+        REQUIRE(subscribers.get_num_subscribers() == 0);
+    }
+
+    SECTION("Unsubscribe from within call") {
+        rdk::Subscription subscription_a = subscribers.add(&a);
+        auto subscription_b = subscribers.add(&b);
+
+        subscribers.call([&](CountingSubscriber& s) {
+            s.callback();
+            subscription_a.reset();
+        });
+
+        REQUIRE(a.num_calls == 1);
+        REQUIRE(b.num_calls == 1);
+        REQUIRE(subscribers.get_num_subscribers() == 1);
+        REQUIRE_FALSE(subscribers.has_subscriber(&a));
+    }
+
+    SECTION("Unsubscribe from another list from within call waits for readers of that list") {
+        rdk::ConcurrentSubscriberList<CountingSubscriber> other;
+        auto subscription_a = subscribers.add(&a);
+        auto subscription_b = other.add(&b);
+
+        std::atomic<bool> reading {false};
+        std::atomic<bool> release {false};
+        std::atomic<bool> finished {false};
+
+        std::thread reader([&] {
+            other.call([&](CountingSubscriber&) {
+                reading = true;
+                while (!release) {
+                    std::this_thread::yield();
+                }
+                finished = true;
+            });
+        });
+
+        while (!reading) {
+            std::this_thread::yield();
+        }
+
+        bool finished_before_unsubscribe_returned = false;
+        subscribers.call([&](CountingSubscriber&) {
+            std::thread releaser([&] {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+                release = true;
+            });
+            subscription_b.reset();
+            finished_before_unsubscribe_returned = finished;
+            releaser.join();
+        });
+
+        reader.join();
+        REQUIRE(finished_before_unsubscribe_returned);
+    }
+
+    SECTION("Subscription outliving the list") {
+        rdk::Subscription subscription;
+        {
+            rdk::ConcurrentSubscriberList<CountingSubscriber> list;
+            subscription = list.add(&a);
+        }
+        subscription.reset();
+        REQUIRE_FALSE(subscription);
+    }
+}
+
+TEST_CASE("ConcurrentSubscriberList stress test", "[ConcurrentSubscriberList]") {
+    constexpr size_t kNumReaders = 2;
+    constexpr size_t kNumWriters = 2;
+    constexpr size_t kNumSubscribersPerWriter = 8;
+    constexpr int kNumIterations = 2000;
+
+    rdk::ConcurrentSubscriberList<CountingSubscriber> subscribers;
+
+    std::atomic<bool> done {false};
+    std::atomic<size_t> calls_after_unsubscribe {0};
+    std::atomic<size_t> num_dispatches {0};
+
+    std::vector<std::thread> readers;
+    for (size_t i = 0; i < kNumReaders; ++i) {
+        readers.emplace_back([&] {
+            while (!done.load()) {
+                subscribers.call([&](CountingSubscriber& s) {
+                    if (s.unsubscribed.load()) {
+                        calls_after_unsubscribe.fetch_add(1);
+                    }
+                    s.callback();
+                });
+                num_dispatches.fetch_add(1);
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (size_t i = 0; i < kNumWriters; ++i) {
+        writers.emplace_back([&] {
+            std::vector<CountingSubscriber> own(kNumSubscribersPerWriter);
+            std::vector<rdk::Subscription> subscriptions(kNumSubscribersPerWriter);
+
+            for (int iteration = 0; iteration < kNumIterations; ++iteration) {
+                const auto index = static_cast<size_t>(iteration) % kNumSubscribersPerWriter;
+                auto& subscriber = own[index];
+
+                if (subscriptions[index]) {
+                    subscriptions[index].reset();
+                    // From here on the subscriber must never be called again, until it subscribes again.
+                    subscriber.unsubscribed.store(true);
+                } else {
+                    subscriber.unsubscribed.store(false);
+                    subscriptions[index] = subscribers.add(&subscriber);
+                }
+            }
+
+            for (size_t index = 0; index < kNumSubscribersPerWriter; ++index) {
+                subscriptions[index].reset();
+                own[index].unsubscribed.store(true);
+            }
+        });
+    }
+
+    for (auto& writer : writers) {
+        writer.join();
+    }
+
+    done.store(true);
+
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    REQUIRE(calls_after_unsubscribe.load() == 0);
+    REQUIRE(num_dispatches.load() > 0);
+    REQUIRE(subscribers.get_num_subscribers() == 0);
+}
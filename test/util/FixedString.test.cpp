@@ -0,0 +1,110 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/FixedString.h"
+#include "rdk/util/StringUtilities.h"
+
+#include <array>
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+struct Route {
+    rdk::FixedString<16> prefix;
+    int output;
+};
+
+constexpr std::array<Route, 4> kRoutes {{
+    {"/audio/", 1},
+    {"/control/", 2},
+    {"/meters/", 3},
+    {"/video/", 4},
+}};
+
+constexpr bool routes_are_valid() {
+    for (size_t i = 0; i < kRoutes.size(); ++i) {
+        if (!rdk::starts_with(kRoutes[i].prefix, "/") || !rdk::ends_with(kRoutes[i].prefix, "/"))
+            return false;
+        if (i > 0 && !(kRoutes[i - 1].prefix < kRoutes[i].prefix))
+            return false;
+    }
+    return true;
+}
+
+constexpr int route(const std::string_view path) {
+    for (const auto& entry : kRoutes) {
+        if (rdk::starts_with(path, entry.prefix))
+            return entry.output;
+    }
+    return 0;
+}
+
+static_assert(routes_are_valid());
+static_assert(route("/control/gain") == 2);
+static_assert(route("/unknown") == 0);
+
+constexpr rdk::FixedString<8> make_label(const int index) {
+    rdk::FixedString<8> label("Ch ");
+    label.push_back(static_cast<char>('0' + index / 10));
+    label.push_back(static_cast<char>('0' + index % 10));
+    return label;
+}
+
+static_assert(make_label(7) == "Ch 07");
+static_assert(make_label(42).size() == 5);
+
+}  // namespace
+
+TEST_CASE("FixedString", "[FixedString]") {
+    SECTION("Construction") {
+        constexpr rdk::FixedString<8> empty;
+        static_assert(empty.empty());
+        static_assert(empty.size() == 0);
+        static_assert(empty.c_str()[0] == '\0');
+        static_assert(rdk::FixedString<8>::capacity() == 8);
+
+        constexpr rdk::FixedString<8> literal("RTP/AVP");
+        static_assert(literal.size() == 7);
+        static_assert(literal == "RTP/AVP");
+        static_assert(literal[4] == 'A');
+
+        constexpr rdk::FixedString<4> truncated(std::string_view("abcdef"));
+        static_assert(truncated == "abcd");
+        static_assert(truncated.c_str()[4] == '\0');
+
+        REQUIRE(std::string(literal.c_str()) == "RTP/AVP");
+        REQUIRE(std::string(literal.begin(), literal.end()) == "RTP/AVP");
+    }
+
+    SECTION("Append") {
+        rdk::FixedString<6> str("abc");
+        REQUIRE(str.append("de"));
+        REQUIRE(str == "abcde");
+        REQUIRE_FALSE(str.append("fg"));
+        REQUIRE(str == "abcde");
+        REQUIRE(str.push_back('f'));
+        REQUIRE_FALSE(str.push_back('g'));
+        REQUIRE(str == "abcdef");
+        REQUIRE(std::string_view(str.c_str()) == "abcdef");
+
+        str.clear();
+        REQUIRE(str.empty());
+        REQUIRE(std::string_view(str.c_str()).empty());
+    }
+
+    SECTION("Comparison") {
+        static_assert(rdk::FixedString<4>("abc") == rdk::FixedString<8>("abc"));
+        static_assert(rdk::FixedString<4>("abc") != rdk::FixedString<8>("abd"));
+        static_assert(rdk::FixedString<4>("abc") < rdk::FixedString<8>("abd"));
+        static_assert("abc" == rdk::FixedString<4>("abc"));
+        static_assert(rdk::FixedString<4>("abc") != "ab");
+    }
+
+    SECTION("Routing at runtime") {
+        REQUIRE(route("/audio/1") == 1);
+        REQUIRE(route("/video/2") == 4);
+        REQUIRE(route("/vid") == 0);
+    }
+}
@@ -0,0 +1,129 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/FlatStringMap.h"
+
+#include <catch2/catch_all.hpp>
+#include <map>
+#include <random>
+
+TEST_CASE("FlatStringMap", "[FlatStringMap]") {
+    rdk::FlatStringMap<int> map;
+
+    SECTION("Insert, find and erase") {
+        REQUIRE(map.empty());
+        REQUIRE(map.find("a") == nullptr);
+        REQUIRE_FALSE(map.erase("a"));
+
+        const auto [value, inserted] = map.try_emplace("gain", 1);
+        REQUIRE(inserted);
+        REQUIRE(*value == 1);
+
+        const auto [existing, inserted_again] = map.try_emplace("gain", 2);
+        REQUIRE_FALSE(inserted_again);
+        REQUIRE(existing == value);
+        REQUIRE(*existing == 1);
+
+        map["mute"] = 3;
+        map["mute"] += 1;
+        REQUIRE(map.insert_or_assign("gain", 5).second == false);
+        REQUIRE(map.insert_or_assign("pan", 6).second == true);
+
+        REQUIRE(map.size() == 3);
+        REQUIRE(*map.find("gain") == 5);
+        REQUIRE(*map.find("mute") == 4);
+        REQUIRE(map.contains("pan"));
+        REQUIRE_FALSE(map.contains("gai"));
+
+        // Lookup with a slice of a larger string.
+        const std::string path = "/channel/1/mute";
+        REQUIRE(*map.find(std::string_view(path).substr(11)) == 4);
+
+        REQUIRE(map.erase("mute"));
+        REQUIRE_FALSE(map.erase("mute"));
+        REQUIRE(map.find("mute") == nullptr);
+        REQUIRE(map.size() == 2);
+
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE(map.find("gain") == nullptr);
+    }
+
+    SECTION("Empty key") {
+        map[""] = 1;
+        REQUIRE(map.contains(""));
+        REQUIRE(map.erase(""));
+        REQUIRE(map.empty());
+    }
+
+    SECTION("Copy and move") {
+        for (int i = 0; i < 100; ++i) {
+            map[std::to_string(i)] = i;
+        }
+
+        auto copy = map;
+        REQUIRE(copy.size() == 100);
+        REQUIRE(*copy.find("42") == 42);
+        copy["42"] = 0;
+        REQUIRE(*map.find("42") == 42);
+
+        auto moved = std::move(copy);
+        REQUIRE(moved.size() == 100);
+        REQUIRE(*moved.find("42") == 0);
+
+        size_t count = 0;
+        int sum = 0;
+        map.for_each([&](const std::string_view key, const int value) {
+            REQUIRE(key == std::to_string(value));
+            count++;
+            sum += value;
+        });
+        REQUIRE(count == 100);
+        REQUIRE(sum == 4950);
+    }
+
+    SECTION("Randomized against std::map") {
+        std::mt19937 rng(42);
+        std::map<std::string, int, std::less<>> reference;
+
+        for (int i = 0; i < 200'000; ++i) {
+            // Few distinct keys, so keys are erased and inserted again, which exercises backward shift deletion.
+            const auto key = "key" + std::to_string(rng() % 2000);
+            switch (rng() % 3) {
+                case 0:
+                    REQUIRE(map.insert_or_assign(key, i).second == reference.insert_or_assign(key, i).second);
+                    break;
+                case 1:
+                    REQUIRE(map.erase(key) == (reference.erase(key) == 1));
+                    break;
+                default: {
+                    const auto* value = map.find(key);
+                    const auto it = reference.find(key);
+                    REQUIRE((value != nullptr) == (it != reference.end()));
+                    if (value != nullptr) {
+                        REQUIRE(*value == it->second);
+                    }
+                }
+            }
+            REQUIRE(map.size() == reference.size());
+        }
+
+        for (const auto& [key, value] : reference) {
+            REQUIRE(*map.find(key) == value);
+        }
+    }
+
+    SECTION("Move only values") {
+        rdk::FlatStringMap<std::unique_ptr<int>> pointers;
+        for (int i = 0; i < 100; ++i) {
+            pointers.try_emplace(std::to_string(i), std::make_unique<int>(i));
+        }
+        for (int i = 0; i < 100; i += 2) {
+            REQUIRE(pointers.erase(std::to_string(i)));
+        }
+        REQUIRE(pointers.size() == 50);
+        REQUIRE(**pointers.find("51") == 51);
+    }
+}
@@ -0,0 +1,55 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/Hash.h"
+
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <unordered_set>
+
+TEST_CASE("Hash", "[Hash]") {
+    SECTION("Equal input gives equal hashes") {
+        const std::string str = "Device 1 Stream 2";
+        REQUIRE(rdk::hash_bytes(str) == rdk::hash_bytes(std::string_view("Device 1 Stream 2")));
+        REQUIRE(rdk::hash_bytes(str) == rdk::hash_memory(str.data(), str.size()));
+        REQUIRE(rdk::StringHash()(str) == rdk::StringHash()("Device 1 Stream 2"));
+        REQUIRE(rdk::StringEqual()(str, "Device 1 Stream 2"));
+    }
+
+    SECTION("Seed changes the hash") {
+        REQUIRE(rdk::hash_bytes("abc", 1) != rdk::hash_bytes("abc", 2));
+        REQUIRE(rdk::hash_bytes("abc", 1) != rdk::hash_bytes("abc"));
+        REQUIRE(rdk::hash_memory("abc", 3, 1) != rdk::hash_memory("abc", 3, 2));
+
+        // A string literal with a seed hashes the whole string, the seed is not taken as size.
+        REQUIRE(rdk::hash_bytes("abc", 1) == rdk::hash_memory("abc", 3, 1));
+    }
+
+    SECTION("No collisions for similar keys of every length") {
+        // Covers all code paths: 0-3, 4-16, 17-48 and more than 48 bytes.
+        std::unordered_set<uint64_t> hashes;
+        size_t count = 0;
+        for (size_t length = 0; length < 200; ++length) {
+            std::string key(length, 'a');
+            hashes.insert(rdk::hash_bytes(key));
+            count++;
+            for (size_t i = 0; i < length; ++i) {
+                key[i] = 'b';
+                hashes.insert(rdk::hash_bytes(key));
+                key[i] = 'a';
+                count++;
+            }
+        }
+        REQUIRE(hashes.size() == count);
+    }
+
+    SECTION("Only the given bytes are hashed") {
+        const std::string a = "prefix-key-suffix-a";
+        const std::string b = "prefix-key-suffix-b";
+        for (size_t length = 0; length < a.size() - 1; ++length) {
+            REQUIRE(rdk::hash_memory(a.data(), length) == rdk::hash_memory(b.data(), length));
+        }
+    }
+}
@@ -0,0 +1,75 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/InplaceFunction.h"
+
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <memory>
+
+TEST_CASE("InplaceFunction", "[InplaceFunction]") {
+    SECTION("Default constructed function is empty") {
+        rdk::InplaceFunction<void()> function;
+        REQUIRE_FALSE(function);
+    }
+
+    SECTION("Invoke with arguments and return value") {
+        int offset = 10;
+        rdk::InplaceFunction<int(int, int)> function([offset](const int a, const int b) { return a + b + offset; });
+        REQUIRE(function);
+        REQUIRE(function(1, 2) == 13);
+    }
+
+    SECTION("Move transfers the callable") {
+        int count = 0;
+        rdk::InplaceFunction<void()> a([&count] { count++; });
+        rdk::InplaceFunction<void()> b(std::move(a));
+        REQUIRE_FALSE(a);
+        REQUIRE(b);
+        b();
+        REQUIRE(count == 1);
+
+        rdk::InplaceFunction<void()> c;
+        c = std::move(b);
+        REQUIRE_FALSE(b);
+        c();
+        REQUIRE(count == 2);
+    }
+
+    SECTION("Move-only captures") {
+        auto value = std::make_unique<int>(42);
+        rdk::InplaceFunction<int()> function([v = std::move(value)] { return *v; });
+        REQUIRE(function() == 42);
+    }
+
+    SECTION("Captured state is destroyed exactly once") {
+        auto shared = std::make_shared<int>(0);
+        {
+            rdk::InplaceFunction<void()> a([shared] {});
+            REQUIRE(shared.use_count() == 2);
+            rdk::InplaceFunction<void()> b(std::move(a));
+            REQUIRE(shared.use_count() == 2);
+            b.reset();
+            REQUIRE(shared.use_count() == 1);
+        }
+        REQUIRE(shared.use_count() == 1);
+    }
+
+    SECTION("Empty nullable callables result in an empty function") {
+        rdk::InplaceFunction<void()> from_function {std::function<void()>()};
+        REQUIRE_FALSE(from_function);
+
+        void (*function_pointer)() = nullptr;
+        rdk::InplaceFunction<void()> from_pointer {function_pointer};
+        REQUIRE_FALSE(from_pointer);
+    }
+
+    SECTION("Large callables can be wrapped in std::function") {
+        std::array<int, 64> large {};
+        large[63] = 5;
+        rdk::InplaceFunction<int()> function(std::function<int()>([large] { return large[63]; }));
+        REQUIRE(function() == 5);
+    }
+}
@@ -0,0 +1,115 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ParseNumbers.h"
+
+#include <catch2/catch_all.hpp>
+#include <random>
+
+TEST_CASE("ParseNumbers", "[ParseNumbers]") {
+    SECTION("Integers into an output iterator") {
+        std::vector<int> values;
+        const auto text = "1, -2,3 ,  42,-2147483648,2147483647";
+        const auto result = rdk::parse_numbers<int>(text, ',', std::back_inserter(values));
+        REQUIRE(result);
+        REQUIRE(result.num_values == 6);
+        REQUIRE(result.error_offset == std::string_view::npos);
+        REQUIRE(values == std::vector<int> {1, -2, 3, 42, INT32_MIN, INT32_MAX});
+    }
+
+    SECTION("Floating point values into an array") {
+        double values[4] {};
+        const auto result = rdk::parse_numbers("0.5\n-1e3\n3.25\n", '\n', values, std::size(values));
+        REQUIRE(result);
+        REQUIRE(result.num_values == 3);
+        REQUIRE(values[0] == 0.5);
+        REQUIRE(values[1] == -1000.0);
+        REQUIRE(values[2] == 3.25);
+    }
+
+    SECTION("Whitespace delimiter") {
+        std::vector<uint16_t> values;
+        REQUIRE(rdk::parse_numbers<uint16_t>("1 2\t3 65535", ' ', std::back_inserter(values)).error_offset == 2);
+
+        values.clear();
+        REQUIRE(rdk::parse_numbers<uint16_t>("1 2 3 65535", ' ', std::back_inserter(values)));
+        REQUIRE(values == std::vector<uint16_t> {1, 2, 3, 65535});
+    }
+
+    SECTION("Empty text") {
+        std::vector<int> values;
+        REQUIRE(rdk::parse_numbers<int>("", ',', std::back_inserter(values)));
+        REQUIRE(rdk::parse_numbers<int>("  ", ',', std::back_inserter(values)));
+        REQUIRE(values.empty());
+    }
+
+    SECTION("Errors") {
+        std::vector<int> values;
+
+        auto result = rdk::parse_numbers<int>("1,2,x,4", ',', std::back_inserter(values));
+        REQUIRE_FALSE(result);
+        REQUIRE(result.error == std::errc::invalid_argument);
+        REQUIRE(result.error_offset == 4);
+        REQUIRE(result.num_values == 2);
+        REQUIRE(values == std::vector<int> {1, 2});
+
+        result = rdk::parse_numbers<int>("1,2x", ',', std::back_inserter(values));
+        REQUIRE(result.error == std::errc::invalid_argument);
+        REQUIRE(result.error_offset == 2);
+
+        // The offset is the start of the field, not the first character which couldn't be parsed.
+        result = rdk::parse_numbers<int>("7,  1.5,2", ',', std::back_inserter(values));
+        REQUIRE(result.error == std::errc::invalid_argument);
+        REQUIRE(result.error_offset == 4);
+        REQUIRE(result.num_values == 1);
+
+        result = rdk::parse_numbers<int>("1,,2", ',', std::back_inserter(values));
+        REQUIRE(result.error == std::errc::invalid_argument);
+        REQUIRE(result.error_offset == 2);
+
+        result = rdk::parse_numbers<int>("1, 2147483648", ',', std::back_inserter(values));
+        REQUIRE(result.error == std::errc::result_out_of_range);
+        REQUIRE(result.error_offset == 3);
+
+        result = rdk::parse_numbers<unsigned>("-1", ',', std::back_inserter(values));
+        REQUIRE(result.error == std::errc::invalid_argument);
+        REQUIRE(result.error_offset == 0);
+
+        int array[2];
+        result = rdk::parse_numbers("1,2,3", ',', array, std::size(array));
+        REQUIRE(result.error == std::errc::value_too_large);
+        REQUIRE(result.error_offset == 4);
+        REQUIRE(result.num_values == 2);
+    }
+
+    SECTION("Randomized against from_string_strict") {
+        std::mt19937_64 rng(42);
+        std::string text;
+        std::vector<int64_t> expected;
+
+        for (int i = 0; i < 10'000; ++i) {
+            // Values of all lengths, including the ones which take the std::from_chars path.
+            const auto value = static_cast<int64_t>(rng()) >> (rng() % 64);
+            expected.push_back(value);
+            text += std::to_string(value);
+            text += i % 3 == 0 ? " ;" : ";";
+        }
+
+        std::vector<int64_t> values;
+        const auto result = rdk::parse_numbers<int64_t>(text, ';', std::back_inserter(values));
+        REQUIRE(result);
+        REQUIRE(values == expected);
+
+        for (const auto field : {"12345678901234567890", "-9223372036854775809", "00000000000000000000001"}) {
+            std::vector<int64_t> parsed;
+            const auto expected_value = rdk::from_string_strict<int64_t>(field);
+            const auto parse_result = rdk::parse_numbers<int64_t>(field, ';', std::back_inserter(parsed));
+            REQUIRE(static_cast<bool>(parse_result) == expected_value.has_value());
+            if (expected_value) {
+                REQUIRE(parsed.front() == *expected_value);
+            }
+        }
+    }
+}
@@ -0,0 +1,145 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/Result.h"
+
+#include <catch2/catch_all.hpp>
+#include <memory>
+
+namespace {
+
+enum class IoError { kWouldBlock, kClosed };
+
+rdk::Expected<int, rdk::Error<IoError>> parse_digit(const char c) {
+    if (c < '0' || c > '9')
+        return rdk::make_error(IoError::kClosed, "Not a digit");
+    return c - '0';
+}
+
+rdk::Expected<void, IoError> check(const bool ok) {
+    if (!ok)
+        return rdk::unexpected(IoError::kWouldBlock);
+    return {};
+}
+
+}  // namespace
+
+TEST_CASE("Result", "[Result]") {
+    REQUIRE(rdk::ok());
+    REQUIRE(rdk::ok().is_ok());
+    REQUIRE_FALSE(rdk::error("Failed"));
+    REQUIRE(rdk::error("Failed").get_error_message() == "Failed");
+    REQUIRE(rdk::error("").get_error_message() == "Unknown Error");
+}
+
+TEST_CASE("Error", "[Result]") {
+    constexpr rdk::Error<IoError> error(IoError::kWouldBlock, "Would block");
+    static_assert(error.code() == IoError::kWouldBlock);
+    static_assert(error.message() == "Would block");
+    static_assert(!error.context().has_value());
+    static_assert(error == rdk::Error<IoError>(IoError::kWouldBlock));
+    static_assert(error != rdk::Error<IoError>(IoError::kClosed, "Would block"));
+
+    REQUIRE(error.to_string() == "Would block");
+    REQUIRE(rdk::Error<IoError>(IoError::kClosed, "Connection refused", 111).to_string() == "Connection refused (111)");
+    REQUIRE(rdk::Error<IoError>(IoError::kClosed).to_string() == "Unknown Error");
+    REQUIRE(rdk::Error<IoError>(IoError::kClosed, nullptr, 5).context() == 5);
+}
+
+TEST_CASE("Expected", "[Result]") {
+    SECTION("Value and error") {
+        const auto value = parse_digit('7');
+        REQUIRE(value.has_value());
+        REQUIRE(value);
+        REQUIRE(*value == 7);
+        REQUIRE(value.value() == 7);
+        REQUIRE(value.value_or(0) == 7);
+
+        const auto error = parse_digit('x');
+        REQUIRE_FALSE(error.has_value());
+        REQUIRE(error.error().code() == IoError::kClosed);
+        REQUIRE(error.error().message() == "Not a digit");
+        REQUIRE(error.value_or(-1) == -1);
+
+        REQUIRE(rdk::Expected<int, IoError>().value() == 0);
+    }
+
+    SECTION("Void") {
+        REQUIRE(check(true));
+        REQUIRE_FALSE(check(false));
+        REQUIRE(check(false).error() == IoError::kWouldBlock);
+    }
+
+    SECTION("Same value and error type") {
+        rdk::Expected<int, int> value(5);
+        rdk::Expected<int, int> error(rdk::unexpect, 5);
+        REQUIRE(*value == 5);
+        REQUIRE(error.error() == 5);
+    }
+
+    SECTION("and_then") {
+        const auto twice = [](const int value) -> rdk::Expected<int, rdk::Error<IoError>> {
+            return value * 2;
+        };
+        const auto fail = [](int) -> rdk::Expected<int, rdk::Error<IoError>> {
+            return rdk::make_error(IoError::kWouldBlock);
+        };
+
+        REQUIRE(*parse_digit('4').and_then(twice) == 8);
+        REQUIRE(parse_digit('4').and_then(fail).error().code() == IoError::kWouldBlock);
+        REQUIRE(parse_digit('x').and_then(twice).error().code() == IoError::kClosed);
+
+        int calls = 0;
+        const auto count = [&calls]() -> rdk::Expected<void, IoError> {
+            calls++;
+            return {};
+        };
+        REQUIRE(check(true).and_then(count));
+        REQUIRE_FALSE(check(false).and_then(count));
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("map") {
+        const auto to_string = [](const int value) {
+            return std::to_string(value);
+        };
+        REQUIRE(*parse_digit('3').map(to_string) == "3");
+        REQUIRE(parse_digit('x').map(to_string).error().code() == IoError::kClosed);
+
+        int sum = 0;
+        const auto add = [&sum](const int value) {
+            sum += value;
+        };
+        const rdk::Expected<void, rdk::Error<IoError>> added = parse_digit('3').map(add);
+        REQUIRE(added);
+        REQUIRE(sum == 3);
+
+        REQUIRE(*check(true).map([] { return 1; }) == 1);
+        REQUIRE(check(false).map([] { return 1; }).error() == IoError::kWouldBlock);
+    }
+
+    SECTION("or_else") {
+        const auto recover = [](const rdk::Error<IoError>& error) -> rdk::Expected<int, rdk::Error<IoError>> {
+            if (error.code() == IoError::kClosed)
+                return 0;
+            return rdk::unexpected(error);
+        };
+        REQUIRE(*parse_digit('x').or_else(recover) == 0);
+        REQUIRE(*parse_digit('9').or_else(recover) == 9);
+
+        const auto ignore = [](IoError) -> rdk::Expected<void, IoError> {
+            return {};
+        };
+        REQUIRE(check(false).or_else(ignore));
+    }
+
+    SECTION("Move only value") {
+        auto pointer = rdk::Expected<std::unique_ptr<int>, IoError>(std::make_unique<int>(4))
+                           .map([](std::unique_ptr<int> p) {
+                               return *p + 1;
+                           });
+        REQUIRE(*pointer == 5);
+    }
+}
@@ -6,6 +6,7 @@
 #include "rdk/util/ScopedAtomicCounter.h"
 
 #include <catch2/catch_all.hpp>
+#include <vector>
 
 TEST_CASE("Previous value", "[ScopedAtomicCounter]") {
     std::atomic<int> atomic {};
@@ -102,3 +103,108 @@ TEST_CASE("Copy construction lambda", "[ScopedAtomicCounter]") {
     }
     REQUIRE(atomic.load() == 0);
 }
+
+TEST_CASE("Copy assignment to another counter", "[ScopedAtomicCounter]") {
+    std::atomic<int> first {};
+    std::atomic<int> second {};
+
+    {
+        ScopedAtomicCounter a(first);
+        const ScopedAtomicCounter b(second);
+        REQUIRE(first.load() == 1);
+        REQUIRE(second.load() == 1);
+
+        a = b;
+        REQUIRE(a.previous_value() == 1);
+        REQUIRE(first.load() == 0);
+        REQUIRE(second.load() == 2);
+    }
+    REQUIRE(first.load() == 0);
+    REQUIRE(second.load() == 0);
+}
+
+TEST_CASE("Self assignment", "[ScopedAtomicCounter]") {
+    std::atomic<int> atomic {};
+
+    {
+        ScopedAtomicCounter a(atomic);
+        auto& ref = a;
+        a = ref;
+        REQUIRE(atomic.load() == 1);
+        a = std::move(ref);
+        REQUIRE(atomic.load() == 1);
+    }
+    REQUIRE(atomic.load() == 0);
+}
+
+TEST_CASE("Move construction", "[ScopedAtomicCounter]") {
+    std::atomic<int> atomic {};
+
+    {
+        ScopedAtomicCounter a(atomic);
+        {
+            const ScopedAtomicCounter b(std::move(a));
+            REQUIRE(b.previous_value() == 0);
+            REQUIRE(atomic.load() == 1);
+        }
+        REQUIRE(atomic.load() == 0);
+
+        // A moved from counter can be copied, which doesn't increment anything.
+        const ScopedAtomicCounter c(a);
+        REQUIRE(atomic.load() == 0);
+    }
+    REQUIRE(atomic.load() == 0);
+}
+
+TEST_CASE("Move assignment", "[ScopedAtomicCounter]") {
+    std::atomic<int> first {};
+    std::atomic<int> second {};
+
+    {
+        ScopedAtomicCounter a(first);
+        ScopedAtomicCounter b(second);
+
+        a = std::move(b);
+        REQUIRE(first.load() == 0);
+        REQUIRE(second.load() == 1);
+    }
+    REQUIRE(first.load() == 0);
+    REQUIRE(second.load() == 0);
+}
+
+TEST_CASE("Move into a container", "[ScopedAtomicCounter]") {
+    std::atomic<int> atomic {};
+
+    {
+        std::vector<ScopedAtomicCounter<int>> counters;
+        for (int i = 0; i < 10; ++i) {
+            counters.emplace_back(atomic);
+        }
+        REQUIRE(atomic.load() == 10);
+        counters.erase(counters.begin(), counters.begin() + 5);
+        REQUIRE(atomic.load() == 5);
+    }
+    REQUIRE(atomic.load() == 0);
+}
+
+TEST_CASE("Reset", "[ScopedAtomicCounter]") {
+    std::atomic<int> atomic {};
+
+    ScopedAtomicCounter a(atomic);
+    a.reset();
+    REQUIRE(atomic.load() == 0);
+    a.reset();
+    REQUIRE(atomic.load() == 0);
+}
+
+TEST_CASE("Relaxed memory order and unsigned types", "[ScopedAtomicCounter]") {
+    std::atomic<size_t> atomic {};
+
+    {
+        const ScopedAtomicCounter<size_t, std::memory_order_relaxed> a(atomic);
+        const auto b = a;
+        REQUIRE(b.previous_value() == 1);
+        REQUIRE(atomic.load() == 2);
+    }
+    REQUIRE(atomic.load() == 0);
+}
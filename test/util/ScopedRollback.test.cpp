@@ -0,0 +1,68 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ScopedRollback.h"
+
+#include <catch2/catch_all.hpp>
+
+TEST_CASE("ScopedRollback", "[ScopedRollback]") {
+    std::vector<int> order;
+
+    SECTION("Rollback on destruction in reverse order") {
+        {
+            rdk::ScopedRollback rollback([&order] { order.push_back(1); });
+            rollback.add([&order] { order.push_back(2); });
+            rollback.add([&order] { order.push_back(3); });
+            REQUIRE(rollback.size() == 3);
+            REQUIRE(order.empty());
+        }
+        REQUIRE(order == std::vector<int> {3, 2, 1});
+    }
+
+    SECTION("Cancel") {
+        {
+            rdk::ScopedRollback rollback;
+            rollback.add([&order] { order.push_back(1); });
+            rollback.add([&order] { order.push_back(2); });
+            rollback.cancel();
+            REQUIRE(rollback.size() == 0);
+
+            rollback.add([&order] { order.push_back(3); });
+        }
+        REQUIRE(order == std::vector<int> {3});
+    }
+
+    SECTION("More functions than the inline capacity") {
+        {
+            rdk::ScopedRollback<2> rollback;
+            for (int i = 1; i <= 5; ++i) {
+                rollback.add([&order, i] { order.push_back(i); });
+            }
+            REQUIRE(rollback.size() == 5);
+        }
+        REQUIRE(order == std::vector<int> {5, 4, 3, 2, 1});
+    }
+
+    SECTION("Cancel with more functions than the inline capacity") {
+        {
+            rdk::ScopedRollback<1> rollback;
+            for (int i = 1; i <= 3; ++i) {
+                rollback.add([&order, i] { order.push_back(i); });
+            }
+            rollback.cancel();
+        }
+        REQUIRE(order.empty());
+    }
+
+    SECTION("std::function and empty functions") {
+        {
+            rdk::ScopedRollback rollback;
+            rollback.add(std::function<void()>([&order] { order.push_back(1); }));
+            rollback.add(std::function<void()>());
+            rollback.add(nullptr);
+        }
+        REQUIRE(order == std::vector<int> {1});
+    }
+}
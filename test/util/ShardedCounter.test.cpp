@@ -0,0 +1,141 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/ShardedCounter.h"
+
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <thread>
+#include <vector>
+
+TEST_CASE("ShardedCounter add and load", "[ShardedCounter]") {
+    rdk::ShardedCounter<int> counter(4, 8);
+    REQUIRE(counter.shard_count() == 4);
+    REQUIRE(counter.load() == 0);
+
+    counter.increment();
+    counter.increment();
+    counter.decrement();
+    REQUIRE(counter.load() == 1);
+    REQUIRE(counter.load_approximate() == 0);
+
+    counter.add(100);
+    REQUIRE(counter.load() == 101);
+    REQUIRE(counter.load_approximate() == 101);
+
+    counter.add(-150);
+    REQUIRE(counter.load() == -49);
+    REQUIRE(counter.load_approximate() == -49);
+}
+
+TEST_CASE("ShardedCounter rounds the number of shards up to a power of two", "[ShardedCounter]") {
+    REQUIRE(rdk::ShardedCounter<int>(0, 1).shard_count() == 1);
+    REQUIRE(rdk::ShardedCounter<int>(3, 1).shard_count() == 4);
+    REQUIRE(rdk::ShardedCounter<int>(16, 1).shard_count() == 16);
+    REQUIRE(rdk::ShardedCounter<int>().shard_count() >= std::thread::hardware_concurrency());
+}
+
+TEST_CASE("ShardedCounter approximate value stays within bounds", "[ShardedCounter]") {
+    rdk::ShardedCounter<int64_t> counter(1, 16);
+    for (int64_t i = 1; i <= 1000; ++i) {
+        counter.increment();
+        REQUIRE(counter.load() == i);
+        REQUIRE(i - counter.load_approximate() < 16);
+    }
+}
+
+TEST_CASE("ScopedShardedCounter", "[ShardedCounter]") {
+    rdk::ShardedCounter<int> counter;
+
+    SECTION("Construction and destruction") {
+        {
+            const rdk::ScopedShardedCounter a(counter);
+            REQUIRE(counter.load() == 1);
+            const rdk::ScopedShardedCounter b(counter);
+            REQUIRE(counter.load() == 2);
+        }
+        REQUIRE(counter.load() == 0);
+    }
+
+    SECTION("Copy") {
+        {
+            const rdk::ScopedShardedCounter a(counter);
+            const auto b = a;
+            REQUIRE(counter.load() == 2);
+        }
+        REQUIRE(counter.load() == 0);
+    }
+
+    SECTION("Copy assignment") {
+        rdk::ShardedCounter<int> other;
+        {
+            rdk::ScopedShardedCounter a(counter);
+            const rdk::ScopedShardedCounter b(other);
+            a = b;
+            REQUIRE(counter.load() == 0);
+            REQUIRE(other.load() == 2);
+        }
+        REQUIRE(counter.load() == 0);
+        REQUIRE(other.load() == 0);
+    }
+
+    SECTION("Move") {
+        {
+            rdk::ScopedShardedCounter a(counter);
+            const auto b = std::move(a);
+            REQUIRE(counter.load() == 1);
+        }
+        REQUIRE(counter.load() == 0);
+    }
+
+    SECTION("Move assignment") {
+        {
+            rdk::ScopedShardedCounter a(counter);
+            rdk::ScopedShardedCounter b(counter);
+            REQUIRE(counter.load() == 2);
+            b = std::move(a);
+            REQUIRE(counter.load() == 1);
+        }
+        REQUIRE(counter.load() == 0);
+    }
+
+    SECTION("Reset") {
+        rdk::ScopedShardedCounter a(counter);
+        a.reset();
+        REQUIRE(counter.load() == 0);
+        a.reset();
+        REQUIRE(counter.load() == 0);
+    }
+
+    SECTION("Destroyed on another thread") {
+        auto scoped = std::make_unique<rdk::ScopedShardedCounter<int>>(counter);
+        std::thread([&] {
+            scoped.reset();
+        }).join();
+        REQUIRE(counter.load() == 0);
+    }
+}
+
+TEST_CASE("ShardedCounter from multiple threads", "[ShardedCounter]") {
+    constexpr int kNumThreads = 8;
+    constexpr int kIterations = 10000;
+
+    rdk::ShardedCounter<int64_t> counter(4, 16);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&counter] {
+            for (int i = 0; i < kIterations; ++i) {
+                const rdk::ScopedShardedCounter scoped(counter);
+                counter.add(2);
+                counter.decrement();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(counter.load() == int64_t {kNumThreads} * kIterations);
+}
@@ -0,0 +1,78 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/SpscQueue.h"
+
+#include <catch2/catch_all.hpp>
+#include <memory>
+#include <thread>
+
+TEST_CASE("SpscQueue", "[SpscQueue]") {
+    SECTION("Push and pop in order") {
+        rdk::SpscQueue<int, 4> queue;
+        REQUIRE(queue.size_approx() == 0);
+
+        REQUIRE(queue.push(1));
+        REQUIRE(queue.push(2));
+        REQUIRE(queue.push(3));
+        REQUIRE(queue.push(4));
+        REQUIRE_FALSE(queue.push(5));
+        REQUIRE(queue.size_approx() == 4);
+
+        int value = 0;
+        REQUIRE(queue.pop(value));
+        REQUIRE(value == 1);
+        REQUIRE(queue.push(5));
+
+        for (int expected = 2; expected <= 5; ++expected) {
+            REQUIRE(queue.pop(value));
+            REQUIRE(value == expected);
+        }
+
+        REQUIRE_FALSE(queue.pop(value));
+    }
+
+    SECTION("Elements are destroyed") {
+        auto shared = std::make_shared<int>(0);
+        {
+            rdk::SpscQueue<std::shared_ptr<int>, 8> queue;
+            queue.push(shared);
+            queue.push(shared);
+            REQUIRE(shared.use_count() == 3);
+
+            REQUIRE(queue.consume([](std::shared_ptr<int>&) {}));
+            REQUIRE(shared.use_count() == 2);
+        }
+        REQUIRE(shared.use_count() == 1);
+    }
+
+    SECTION("Transfer between threads") {
+        constexpr int kNumElements = 100'000;
+        rdk::SpscQueue<int, 64> queue;
+
+        std::thread producer([&queue] {
+            for (int i = 0; i < kNumElements; ++i) {
+                while (!queue.push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        int expected = 0;
+        bool in_order = true;
+        while (expected < kNumElements) {
+            int value = 0;
+            if (queue.pop(value)) {
+                in_order = in_order && value == expected;
+                expected++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        producer.join();
+        REQUIRE(in_order);
+    }
+}
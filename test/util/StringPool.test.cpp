@@ -0,0 +1,113 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/StringPool.h"
+
+#include <catch2/catch_all.hpp>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+TEST_CASE("StringPool", "[StringPool]") {
+    rdk::StringPool pool;
+
+    SECTION("Interning the same string returns the same handle") {
+        const std::string first = "Stream 1";
+        const std::string second = "Stream 1";
+
+        const auto a = pool.intern(first);
+        const auto b = pool.intern(second);
+        const auto c = pool.intern("Stream 2");
+
+        REQUIRE(a == b);
+        REQUIRE(a != c);
+        REQUIRE(a.view() == "Stream 1");
+        REQUIRE(a.view().data() == b.view().data());
+        REQUIRE(a.view().data() != first.data());
+        REQUIRE(std::string(a.c_str()) == "Stream 1");
+        REQUIRE(a.size() == 8);
+        REQUIRE(a.hash() == rdk::StringHash()("Stream 1"));
+        REQUIRE(pool.size() == 2);
+    }
+
+    SECTION("Empty string") {
+        const auto empty = pool.intern("");
+        REQUIRE(empty == rdk::InternedString());
+        REQUIRE(empty.empty());
+        REQUIRE(empty.view().empty());
+        REQUIRE(std::string(empty.c_str()).empty());
+        REQUIRE(empty.hash() == rdk::StringHash()(""));
+        REQUIRE(pool.size() == 0);
+    }
+
+    SECTION("Find doesn't add strings") {
+        REQUIRE(pool.find("Device").empty());
+        const auto device = pool.intern("Device");
+        REQUIRE(pool.find("Device") == device);
+        REQUIRE(pool.find("Devic").empty());
+        REQUIRE(pool.size() == 1);
+    }
+
+    SECTION("Handles stay valid while the pool grows") {
+        std::vector<rdk::InternedString> handles;
+        std::vector<std::string_view> views;
+        for (int i = 0; i < 10'000; ++i) {
+            handles.push_back(pool.intern("Channel " + std::to_string(i)));
+            views.push_back(handles.back().view());
+        }
+
+        // Strings larger than an arena chunk.
+        const std::string large(200'000, 'x');
+        const auto large_handle = pool.intern(large);
+        REQUIRE(large_handle.view() == large);
+
+        REQUIRE(pool.size() == 10'001);
+        for (int i = 0; i < 10'000; ++i) {
+            const auto name = "Channel " + std::to_string(i);
+            REQUIRE(handles[static_cast<size_t>(i)].view() == name);
+            REQUIRE(views[static_cast<size_t>(i)].data() == handles[static_cast<size_t>(i)].view().data());
+            REQUIRE(pool.intern(name) == handles[static_cast<size_t>(i)]);
+        }
+        REQUIRE(pool.intern(large) == large_handle);
+    }
+
+    SECTION("Use as key in an unordered_map") {
+        std::unordered_map<rdk::InternedString, int> map;
+        map[pool.intern("a")] = 1;
+        map[pool.intern("b")] = 2;
+        map[pool.intern(std::string("a"))] += 10;
+
+        REQUIRE(map.size() == 2);
+        REQUIRE(map.at(pool.intern("a")) == 11);
+        REQUIRE(map.at(pool.intern("b")) == 2);
+        REQUIRE(std::hash<rdk::InternedString>()(pool.intern("a")) == pool.intern("a").hash());
+    }
+
+    SECTION("Interning from multiple threads") {
+        constexpr size_t kNumThreads = 8;
+        constexpr int kNumStrings = 2'000;
+
+        std::vector<std::vector<rdk::InternedString>> results(kNumThreads);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < kNumThreads; ++t) {
+            threads.emplace_back([&pool, &result = results[t]] {
+                for (int i = 0; i < kNumStrings; ++i) {
+                    result.push_back(pool.intern("Name " + std::to_string(i)));
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        REQUIRE(pool.size() == kNumStrings);
+        for (size_t t = 1; t < kNumThreads; ++t) {
+            REQUIRE(results[t] == results[0]);
+        }
+        for (int i = 0; i < kNumStrings; ++i) {
+            REQUIRE(results[0][static_cast<size_t>(i)].view() == "Name " + std::to_string(i));
+        }
+    }
+}
@@ -0,0 +1,93 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/StringSplit.h"
+
+#include <catch2/catch_all.hpp>
+
+namespace {
+
+template<class Range>
+std::vector<std::string_view> to_tokens(const Range& range) {
+    return {range.begin(), range.end()};
+}
+
+using Tokens = std::vector<std::string_view>;
+
+}  // namespace
+
+TEST_CASE("StringSplit", "[StringSplit]") {
+    SECTION("Character delimiter") {
+        REQUIRE(to_tokens(rdk::split("a,b,c", ',')) == Tokens {"a", "b", "c"});
+        REQUIRE(to_tokens(rdk::split("a,,b,", ',')) == Tokens {"a", "", "b", ""});
+        REQUIRE(to_tokens(rdk::split("abc", ',')) == Tokens {"abc"});
+        REQUIRE(to_tokens(rdk::split("", ',')) == Tokens {""});
+        REQUIRE(to_tokens(rdk::split(",", ',')) == Tokens {"", ""});
+    }
+
+    SECTION("String delimiter") {
+        REQUIRE(to_tokens(rdk::split("v=0\r\ns=Stream\r\nt=0 0", "\r\n")) == Tokens {"v=0", "s=Stream", "t=0 0"});
+        REQUIRE(to_tokens(rdk::split("a::b:c::", "::")) == Tokens {"a", "b:c", ""});
+        REQUIRE(to_tokens(rdk::split("abc", "")) == Tokens {"abc"});
+    }
+
+    SECTION("Character set delimiter") {
+        REQUIRE(to_tokens(rdk::split("a b\tc;d", rdk::any_of(" \t;"))) == Tokens {"a", "b", "c", "d"});
+        REQUIRE(to_tokens(rdk::split("a  b", rdk::any_of(" "))) == Tokens {"a", "", "b"});
+    }
+
+    SECTION("Skip empty tokens") {
+        const auto options = rdk::SplitOptions::kSkipEmpty;
+        REQUIRE(to_tokens(rdk::split(",a,,b,", ',', options)) == Tokens {"a", "b"});
+        REQUIRE(to_tokens(rdk::split("", ',', options)).empty());
+        REQUIRE(to_tokens(rdk::split(",,,", ',', options)).empty());
+        REQUIRE(to_tokens(rdk::split("  a   b ", rdk::any_of(" "), options)) == Tokens {"a", "b"});
+    }
+
+    SECTION("Trim tokens") {
+        REQUIRE(to_tokens(rdk::split(" a , b ,c ", ',', rdk::SplitOptions::kTrim)) == Tokens {"a", "b", "c"});
+        REQUIRE(
+            to_tokens(rdk::split(" a , , b ", ',', rdk::SplitOptions::kTrim | rdk::SplitOptions::kSkipEmpty))
+            == Tokens {"a", "b"}
+        );
+    }
+
+    SECTION("Tokens point into the text") {
+        const std::string_view text = "one two";
+        const auto tokens = to_tokens(rdk::split(text, ' '));
+        REQUIRE(tokens[0].data() == text.data());
+        REQUIRE(tokens[1].data() == text.data() + 4);
+    }
+
+    SECTION("Parse a line of numbers") {
+        std::vector<int> values;
+        for (const auto field : rdk::split("1, 2, 3,42", ',', rdk::SplitOptions::kTrim)) {
+            const auto value = rdk::from_string_strict<int>(field);
+            REQUIRE(value.has_value());
+            values.push_back(*value);
+        }
+        REQUIRE(values == std::vector<int> {1, 2, 3, 42});
+    }
+
+    SECTION("Iterators") {
+        const auto range = rdk::split("a,b", ',');
+        auto it = range.begin();
+        REQUIRE(*it == "a");
+        REQUIRE(it->size() == 1);
+        const auto previous = it++;
+        REQUIRE(*previous == "a");
+        REQUIRE(*it == "b");
+        REQUIRE(++it == range.end());
+        REQUIRE(std::distance(range.begin(), range.end()) == 2);
+    }
+}
+
+TEST_CASE("Test trim", "[StringUtilities]") {
+    REQUIRE(rdk::trim("  a b \t\r\n") == "a b");
+    REQUIRE(rdk::trim("a").size() == 1);
+    REQUIRE(rdk::trim(" \t ").empty());
+    REQUIRE(rdk::trim("").empty());
+    static_assert(rdk::trim(" x ") == "x");
+}
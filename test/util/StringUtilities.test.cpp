@@ -6,6 +6,11 @@
 #include <rdk/util/StringUtilities.h>
 
 #include <catch2/catch_all.hpp>
+#include <unordered_map>
+
+extern "C" {
+#include "natsort/strnatcmp.h"
+}
 
 TEST_CASE("Test upToFirstOccurrenceOf", "[StringUtilities]") {
     constexpr std::string_view haystack("one test two test three test");
@@ -243,6 +248,24 @@ TEST_CASE("Test countNumberOfEqualCharactersFromStart", "[StringUtilities]") {
     REQUIRE(rdk::count_number_of_equal_characters_from_start({"1", "2", "3"}) == 0);
     REQUIRE(rdk::count_number_of_equal_characters_from_start({"1", "2", ""}) == 0);
     REQUIRE(rdk::count_number_of_equal_characters_from_start({"", "", ""}) == 0);
+
+    SECTION("Strings which are prefixes of each other") {
+        REQUIRE(rdk::count_number_of_equal_characters_from_start({"test", "test"}) == 4);
+        REQUIRE(rdk::count_number_of_equal_characters_from_start({"test", "test 1"}) == 4);
+        REQUIRE(rdk::count_number_of_equal_characters_from_start({"test 1", "test 2", "test"}) == 4);
+        REQUIRE(rdk::count_number_of_equal_characters_from_start(std::vector<std::string> {"ab", "abc"}) == 2);
+    }
+
+    SECTION("Long strings") {
+        const std::string base(100, 'x');
+        for (size_t i = 0; i < base.size(); ++i) {
+            auto other = base;
+            other[i] = 'y';
+            REQUIRE(rdk::count_number_of_equal_characters_from_start({base, other, base}) == i);
+            REQUIRE(rdk::common_prefix_length(base, other) == i);
+            REQUIRE(rdk::common_prefix_length(base, std::string_view(base).substr(0, i)) == i);
+        }
+    }
 }
 
 TEST_CASE("Test mergeStrings", "[StringUtilities]") {
@@ -258,6 +281,29 @@ TEST_CASE("Test mergeStrings", "[StringUtilities]") {
         REQUIRE(rdk::merge_strings({"one 1", "two 2", "three 3"}, " & ") == "one 1 & two 2 & three 3");
         REQUIRE(rdk::merge_strings({"equal", "equal", "three 3"}, " & ") == "equal & equal & three 3");
     }
+
+    SECTION("Strings which are prefixes of each other") {
+        REQUIRE(rdk::merge_strings({"equal", "equal"}) == "equal");
+        REQUIRE(rdk::merge_strings({"Mic", "Mic 1", "Mic 2"}) == "Mic & 1 & 2");
+        REQUIRE(rdk::merge_strings({"Mic 1", "Mic 2", "Mic"}) == "Mic 1 & 2");
+    }
+
+    SECTION("Edge cases") {
+        REQUIRE(rdk::merge_strings(std::vector<std::string> {}).empty());
+        REQUIRE(rdk::merge_strings({"single"}) == "single");
+        REQUIRE(rdk::merge_strings({"a", "", "b"}, ", ") == "a, , b");
+    }
+
+    SECTION("string_view input") {
+        const std::string labels = "Channel 1,Channel 2,Channel 3";
+        const std::vector<std::string_view> views {
+            std::string_view(labels).substr(0, 9),
+            std::string_view(labels).substr(10, 9),
+            std::string_view(labels).substr(20, 9),
+        };
+        REQUIRE(rdk::merge_strings(views) == "Channel 1 & 2 & 3");
+        REQUIRE(rdk::count_number_of_equal_characters_from_start(views) == 8);
+    }
 }
 
 TEST_CASE("Test removePrefix", "[StringUtilities]") {
@@ -298,4 +344,220 @@ TEST_CASE("Test removeSuffix", "[StringUtilities]") {
         REQUIRE_FALSE(rdk::remove_suffix(str, "/string"));
         REQUIRE(str == "some/random/string/test");
     }
+
+    SECTION("Suffix longer than the string") {
+        std::string_view str = "string";
+        REQUIRE_FALSE(rdk::remove_suffix(str, "/string"));
+        REQUIRE(str == "string");
+    }
+}
+
+namespace {
+
+constexpr std::string_view remove_prefix_and_suffix(std::string_view str) {
+    rdk::remove_prefix(str, "<");
+    rdk::remove_suffix(str, ">");
+    return str;
+}
+
+}  // namespace
+
+TEST_CASE("Test StringUtilities in constant expressions", "[StringUtilities]") {
+    static_assert(rdk::starts_with("a=rtpmap:96 L24/48000/2", "a=rtpmap:"));
+    static_assert(!rdk::starts_with("a=", "a=rtpmap:"));
+    static_assert(rdk::ends_with("stream.sdp", ".sdp"));
+    static_assert(!rdk::ends_with("sdp", ".sdp"));
+    static_assert(rdk::string_contains("L24/48000/2", '/'));
+    static_assert(!rdk::string_contains("L24", '/'));
+
+    static_assert(rdk::up_to_first_occurrence_of("L24/48000/2", "/", false) == "L24");
+    static_assert(rdk::up_to_the_nth_occurrence_of(2, "L24/48000/2", "/", true) == "L24/48000/");
+    static_assert(rdk::up_to_last_occurrence_of("L24/48000/2", "/", false) == "L24/48000");
+    static_assert(rdk::from_first_occurrence_of("L24/48000/2", "/", false) == "48000/2");
+    static_assert(rdk::from_nth_occurrence_of(2, "L24/48000/2", "/", false) == "2");
+    static_assert(rdk::from_last_occurrence_of("L24/48000/2", "/", true) == "/2");
+    static_assert(rdk::up_to_the_nth_occurrence_of(3, "L24/48000/2", "/", true).empty());
+
+    static_assert(remove_prefix_and_suffix("<value>") == "value");
+    static_assert(remove_prefix_and_suffix("value") == "value");
+
+    static_assert(rdk::common_prefix_length("Input 1", "Input 2") == 6);
+    static_assert(rdk::count_number_of_equal_characters_from_start({"Input 1", "Input 2", "Input 3"}) == 6);
+
+    // The same functions at runtime take the SIMD paths.
+    const std::string text(100, 'x');
+    REQUIRE(rdk::from_nth_occurrence_of(50, text + "/y", "x/", false) == std::string_view());
+    REQUIRE(rdk::from_first_occurrence_of(text + "/y", "x/", false) == "y");
+}
+
+TEST_CASE("Test naturalSortKey", "[StringUtilities]") {
+    const auto sign = [](const int value) {
+        return (value > 0) - (value < 0);
+    };
+
+    SECTION("Keys order like compare_natural") {
+        const std::vector<std::string> strings {
+            "", "a", "A", "a1", "a01", "a001", "a10", "a2", "a 2", "a02", "a0", "a00", "a1b", "a1 b", "1", "10",
+            "9", "09", "0", "x/1", "x:1", "x1", "Channel 11", "channel 2", "Channel 2a", "Channel 2 A", "1.5", "1.05",
+            "1.50", std::string(300, '9'), std::string(300, '9') + "1", "1" + std::string(299, '0'),
+        };
+
+        for (const auto case_sensitive : {false, true}) {
+            for (const auto& lhs : strings) {
+                for (const auto& rhs : strings) {
+                    const auto expected = sign(rdk::compare_natural(lhs, rhs, case_sensitive));
+                    const auto actual = sign(
+                        rdk::natural_sort_key(lhs, case_sensitive).compare(rdk::natural_sort_key(rhs, case_sensitive))
+                    );
+                    INFO(lhs << " <=> " << rhs);
+                    REQUIRE(actual == expected);
+                }
+            }
+        }
+    }
+
+    SECTION("Randomized against compare_natural") {
+        constexpr std::string_view kAlphabet = "0019 aZz.";
+        uint32_t seed = 1;
+        const auto next = [&seed] {
+            seed = seed * 1664525 + 1013904223;
+            return seed >> 16;
+        };
+        const auto make_string = [&] {
+            std::string string(next() % 8, ' ');
+            for (auto& c : string) {
+                c = kAlphabet[next() % kAlphabet.size()];
+            }
+            return string;
+        };
+
+        for (int i = 0; i < 10'000; ++i) {
+            const auto lhs = make_string();
+            const auto rhs = make_string();
+            INFO(lhs << " <=> " << rhs);
+            REQUIRE(
+                sign(rdk::natural_sort_key(lhs).compare(rdk::natural_sort_key(rhs)))
+                == sign(rdk::compare_natural(lhs, rhs, false))
+            );
+        }
+    }
+}
+
+TEST_CASE("Test naturalSort", "[StringUtilities]") {
+    std::vector<std::string> strings {"Channel 10", "channel 2", "Channel 1", "Input 01", "Input 1", "CHANNEL 2"};
+    auto expected = strings;
+    std::stable_sort(expected.begin(), expected.end(), rdk::NumericAwareSortFunctor());
+
+    rdk::natural_sort(strings);
+    REQUIRE(strings == expected);
+    REQUIRE(strings[1] == "channel 2");
+    REQUIRE(strings[2] == "CHANNEL 2");
+}
+
+TEST_CASE("Test compareNatural", "[StringUtilities]") {
+    const auto sign = [](const int value) {
+        return (value > 0) - (value < 0);
+    };
+
+    SECTION("Numbers are compared by value") {
+        REQUIRE(rdk::compare_natural("a2", "a10", true) < 0);
+        REQUIRE(rdk::compare_natural("a10", "a2", true) > 0);
+        REQUIRE(rdk::compare_natural("a 2", "a2", true) == 0);
+        REQUIRE(rdk::compare_natural("1.05", "1.5", true) < 0);
+        REQUIRE(rdk::compare_natural("x", "X", false) == 0);
+        REQUIRE(rdk::compare_natural("x", "X", true) > 0);
+    }
+
+    SECTION("Usable in constant expressions") {
+        static_assert(rdk::compare_natural("Channel 2", "channel 10", false) < 0);
+        static_assert(rdk::NumericAwareSortFunctor()("Input 9", "Input 10"));
+    }
+
+    SECTION("Length bounded") {
+        const std::string_view text = "channel 10 and more";
+        REQUIRE(rdk::compare_natural(text.substr(0, 10), "channel 10", true) == 0);
+        REQUIRE(rdk::compare_natural(text.substr(0, 9), "channel 10", true) < 0);
+    }
+
+    SECTION("Non-ASCII characters order after ASCII characters") {
+        REQUIRE(rdk::compare_natural("\xc3\x96", "Z", false) > 0);
+    }
+
+    SECTION("Randomized against strnatcmp") {
+        constexpr std::string_view kAlphabet = "0019 aAzZ.\t";
+        uint32_t seed = 7;
+        const auto next = [&seed] {
+            seed = seed * 1664525 + 1013904223;
+            return seed >> 16;
+        };
+        const auto make_string = [&] {
+            std::string string(next() % 10, ' ');
+            for (auto& c : string) {
+                c = kAlphabet[next() % kAlphabet.size()];
+            }
+            return string;
+        };
+
+        for (int i = 0; i < 20'000; ++i) {
+            const auto lhs = make_string();
+            const auto rhs = make_string();
+            INFO(lhs << " <=> " << rhs);
+            REQUIRE(sign(rdk::compare_natural(lhs, rhs, true)) == sign(strnatcmp(lhs.c_str(), rhs.c_str())));
+            REQUIRE(sign(rdk::compare_natural(lhs, rhs, false)) == sign(strnatcasecmp(lhs.c_str(), rhs.c_str())));
+        }
+    }
+}
+
+TEST_CASE("Test case insensitive functions", "[StringUtilities]") {
+    static_assert(rdk::to_ascii_lower('A') == 'a');
+    static_assert(rdk::to_ascii_lower('a') == 'a');
+    static_assert(rdk::to_ascii_lower('@') == '@');
+    static_assert(rdk::iequals("Content-Type", "content-type"));
+    static_assert(!rdk::iequals("Content-Type", "content-typ"));
+    static_assert(rdk::istarts_with("A=RTPMAP:96", "a=rtpmap:"));
+    static_assert(rdk::ifind("Stream: AES67 Stream", "aes67") == 8);
+    static_assert(rdk::ifind("Stream", "x") == std::string_view::npos);
+    static_assert(rdk::IEqual()("ABC", "abc"));
+
+    SECTION("iequals") {
+        REQUIRE(rdk::iequals("", ""));
+        REQUIRE(rdk::iequals("Session-Name", "SESSION-NAME"));
+        REQUIRE_FALSE(rdk::iequals("Session-Name", "Session_Name"));
+        REQUIRE_FALSE(rdk::iequals("[", "{"));  // Differ by 0x20, but aren't letters.
+        REQUIRE_FALSE(rdk::iequals("\xc1", "\xe1"));
+
+        const std::string long_lower = "a very long header name which is longer than a single avx2 register";
+        std::string long_upper = long_lower;
+        std::transform(long_upper.begin(), long_upper.end(), long_upper.begin(), rdk::to_ascii_upper);
+        REQUIRE(rdk::iequals(long_lower, long_upper));
+        long_upper[50] = '!';
+        REQUIRE_FALSE(rdk::iequals(long_lower, long_upper));
+    }
+
+    SECTION("istarts_with") {
+        REQUIRE(rdk::istarts_with("Transfer-Encoding: chunked", "transfer-encoding:"));
+        REQUIRE_FALSE(rdk::istarts_with("Transfer", "transfer-encoding:"));
+        REQUIRE(rdk::istarts_with("anything", ""));
+    }
+
+    SECTION("ifind") {
+        const std::string sdp = "v=0\r\ns=Studio\r\na=RTPMAP:96 L24/48000/2\r\na=ts-refclk:ptp=IEEE1588-2008\r\n";
+        REQUIRE(rdk::ifind(sdp, "a=rtpmap:") == sdp.find("a=RTPMAP:"));
+        REQUIRE(rdk::ifind(sdp, "ieee1588") == sdp.find("IEEE1588"));
+        REQUIRE(rdk::ifind(sdp, "ptp=ieee1589") == std::string_view::npos);
+        REQUIRE(rdk::ifind(sdp, "") == 0);
+        REQUIRE(rdk::ifind("", "a") == std::string_view::npos);
+    }
+
+    SECTION("ihash, IHash and IEqual") {
+        REQUIRE(rdk::ihash("Content-Length") == rdk::ihash("content-length"));
+        REQUIRE(rdk::ihash("Content-Length") != rdk::ihash("Content-Lengths"));
+        REQUIRE(rdk::ihash("") == rdk::ihash(""));
+
+        std::unordered_map<std::string, int, rdk::IHash, rdk::IEqual> headers;
+        headers["Content-Length"] = 42;
+        headers["CONTENT-LENGTH"] += 1;
+        REQUIRE(headers.size() == 1);
+        REQUIRE(headers.at("content-length") == 43);
+    }
 }
@@ -111,6 +111,20 @@ TEST_CASE("SubscriberList", "[SharedSubscriberList]") {
         REQUIRE(callbacks == std::vector<std::string> {kSubscriberB});
     }
 
+    SECTION("Callback through std::function") {
+        const std::function<void(LambdaSubscriber&)> function = [](const LambdaSubscriber& s) { s.callback(); };
+        subscribers.call(function);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberB});
+
+        subscribers.call(std::function<void(LambdaSubscriber&)>());
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberB});
+    }
+
+    SECTION("Call member function") {
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberB});
+    }
+
     subscriberA.unsubscribe();
     REQUIRE(subscribers.get_num_subscribers() == 1);
     REQUIRE(subscribers.has_subscriber(&subscriberA) == false);
@@ -118,3 +132,148 @@ TEST_CASE("SubscriberList", "[SharedSubscriberList]") {
     subscriberB.unsubscribe();
     REQUIRE(subscribers.get_num_subscribers() == 0);
 }
+
+TEST_CASE("SubscriberList with many subscribers", "[SharedSubscriberList]") {
+    constexpr size_t kNumSubscribers = 100;
+
+    rdk::SubscriberList<int> subscribers;
+    std::vector<int> values(kNumSubscribers);
+    std::vector<rdk::Subscription> subscriptions;
+
+    for (auto& value : values) {
+        subscriptions.push_back(subscribers.add(&value));
+    }
+    REQUIRE(subscribers.get_num_subscribers() == kNumSubscribers);
+
+    // Remove every other subscriber, which moves subscribers around in the internal array.
+    for (size_t i = 0; i < kNumSubscribers; i += 2) {
+        subscriptions[i].reset();
+    }
+    REQUIRE(subscribers.get_num_subscribers() == kNumSubscribers / 2);
+
+    subscribers.call([](int& value) { value++; });
+
+    for (size_t i = 0; i < kNumSubscribers; ++i) {
+        REQUIRE(values[i] == (i % 2 == 0 ? 0 : 1));
+        REQUIRE(subscribers.has_subscriber(&values[i]) == (i % 2 != 0));
+    }
+
+    // Subscribing again reuses the freed slots, old handles must not affect the new subscriptions.
+    for (size_t i = 0; i < kNumSubscribers; i += 2) {
+        subscriptions[i] = subscribers.add(&values[i]);
+    }
+    REQUIRE(subscribers.get_num_subscribers() == kNumSubscribers);
+
+    subscribers.call([](int& value) { value++; });
+
+    for (size_t i = 0; i < kNumSubscribers; ++i) {
+        REQUIRE(values[i] == (i % 2 == 0 ? 1 : 2));
+    }
+
+    subscriptions.clear();
+    REQUIRE(subscribers.get_num_subscribers() == 0);
+}
+
+TEST_CASE("SubscriberList reentrancy", "[SharedSubscriberList]") {
+    rdk::SubscriberList<LambdaSubscriber> subscribers;
+
+    std::vector<std::string> callbacks;
+
+    SECTION("Subscriber removes itself") {
+        LambdaSubscriber subscriberB([&] { callbacks.emplace_back(kSubscriberB); });
+        LambdaSubscriber subscriberA([&] {
+            callbacks.emplace_back(kSubscriberA);
+            subscriberA.unsubscribe();
+        });
+
+        subscriberA.subscribe_to_subscriber_list(subscribers);
+        subscriberB.subscribe_to_subscriber_list(subscribers);
+
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberB});
+        REQUIRE(subscribers.get_num_subscribers() == 1);
+        REQUIRE_FALSE(subscribers.has_subscriber(&subscriberA));
+
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberB, kSubscriberB});
+    }
+
+    SECTION("Subscriber removes a later subscriber") {
+        LambdaSubscriber subscriberB([&] { callbacks.emplace_back(kSubscriberB); });
+        LambdaSubscriber subscriberC([&] { callbacks.emplace_back(kSubscriberC); });
+        LambdaSubscriber subscriberA([&] {
+            callbacks.emplace_back(kSubscriberA);
+            subscriberB.unsubscribe();
+        });
+
+        subscriberA.subscribe_to_subscriber_list(subscribers);
+        subscriberB.subscribe_to_subscriber_list(subscribers);
+        subscriberC.subscribe_to_subscriber_list(subscribers);
+
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberC});
+        REQUIRE(subscribers.get_num_subscribers() == 2);
+
+        callbacks.clear();
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberC});
+    }
+
+    SECTION("Subscriber adds another subscriber") {
+        LambdaSubscriber subscriberB([&] { callbacks.emplace_back(kSubscriberB); });
+        LambdaSubscriber subscriberA([&] {
+            callbacks.emplace_back(kSubscriberA);
+            subscriberB.subscribe_to_subscriber_list(subscribers);
+        });
+
+        subscriberA.subscribe_to_subscriber_list(subscribers);
+
+        // Subscribers added during a call are not called by that call.
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA});
+        REQUIRE(subscribers.get_num_subscribers() == 2);
+    }
+
+    SECTION("Checked call tells whether the subscriber is still subscribed") {
+        LambdaSubscriber subscriberB([&] { callbacks.emplace_back(kSubscriberB); });
+        LambdaSubscriber subscriberA([&] {
+            callbacks.emplace_back(kSubscriberA);
+            subscriberA.unsubscribe();
+        });
+
+        subscriberA.subscribe_to_subscriber_list(subscribers);
+        subscriberB.subscribe_to_subscriber_list(subscribers);
+
+        subscribers.call_checked([](LambdaSubscriber& subscriber, const auto& is_subscribed) {
+            for (int i = 0; i < 3 && is_subscribed(); ++i) {
+                subscriber.callback();
+            }
+        });
+        REQUIRE(callbacks == std::vector<std::string> {kSubscriberA, kSubscriberB, kSubscriberB, kSubscriberB});
+    }
+
+    SECTION("Nested call") {
+        int depth = 0;
+        LambdaSubscriber subscriberB([&] { callbacks.emplace_back(kSubscriberB); });
+        LambdaSubscriber subscriberA([&] {
+            callbacks.emplace_back(kSubscriberA);
+            if (depth++ == 0) {
+                subscriberB.unsubscribe();
+                subscribers.call_member(&LambdaSubscriber::callback);
+                subscriberA.unsubscribe();
+            }
+        });
+        LambdaSubscriber subscriberC([&] { callbacks.emplace_back(kSubscriberC); });
+
+        subscriberA.subscribe_to_subscriber_list(subscribers);
+        subscriberB.subscribe_to_subscriber_list(subscribers);
+        subscriberC.subscribe_to_subscriber_list(subscribers);
+
+        subscribers.call_member(&LambdaSubscriber::callback);
+        REQUIRE(
+            callbacks == std::vector<std::string> {kSubscriberA, kSubscriberA, kSubscriberC, kSubscriberC}
+        );
+        REQUIRE(subscribers.get_num_subscribers() == 1);
+        REQUIRE(subscribers.has_subscriber(&subscriberC));
+    }
+}
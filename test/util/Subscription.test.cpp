@@ -15,3 +15,51 @@ TEST_CASE("Count destruction callbacks", "[Subscription]") {
     }
     REQUIRE(count == 1);
 }
+
+TEST_CASE("Move construction and assignment", "[Subscription]") {
+    int count_a = 0;
+    int count_b = 0;
+    {
+        rdk::Subscription a([&count_a] { count_a++; });
+        rdk::Subscription b(std::move(a));
+        REQUIRE_FALSE(a);
+        REQUIRE(b);
+        REQUIRE(count_a == 0);
+
+        rdk::Subscription c([&count_b] { count_b++; });
+        c = std::move(b);  // Previous callback of c should be invoked.
+        REQUIRE(count_b == 1);
+        REQUIRE(count_a == 0);
+    }
+    REQUIRE(count_a == 1);
+    REQUIRE(count_b == 1);
+}
+
+TEST_CASE("Reset and neutralize", "[Subscription]") {
+    int count = 0;
+
+    rdk::Subscription subscription([&count] { count++; });
+    subscription.reset();
+    REQUIRE(count == 1);
+    REQUIRE_FALSE(subscription);
+    subscription.reset();
+    REQUIRE(count == 1);
+
+    subscription = [&count] { count++; };
+    REQUIRE(subscription);
+    subscription.neutralize();
+    REQUIRE_FALSE(subscription);
+    REQUIRE(count == 1);
+}
+
+TEST_CASE("Construct from std::function", "[Subscription]") {
+    int count = 0;
+    {
+        rdk::Subscription subscription(std::function<void()>([&count] { count++; }));
+        REQUIRE(subscription);
+
+        rdk::Subscription empty {std::function<void()>()};
+        REQUIRE_FALSE(empty);
+    }
+    REQUIRE(count == 1);
+}
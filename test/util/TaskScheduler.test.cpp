@@ -0,0 +1,314 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/TaskScheduler.h"
+
+#include <catch2/catch_all.hpp>
+#include <future>
+
+namespace {
+
+void wait_for(const std::atomic<int>& value, const int expected) {
+    while (value.load() < expected) {
+        std::this_thread::yield();
+    }
+}
+
+}  // namespace
+
+TEST_CASE("TaskScheduler", "[TaskScheduler]") {
+    SECTION("Posted tasks are executed") {
+        constexpr int kNumTasks = 1000;
+        std::atomic<int> count {0};
+
+        rdk::TaskScheduler scheduler(4);
+        REQUIRE(scheduler.get_num_threads() == 4);
+
+        for (int i = 0; i < kNumTasks; ++i) {
+            scheduler.post([&count] { count.fetch_add(1); });
+        }
+
+        wait_for(count, kNumTasks);
+        REQUIRE(count.load() == kNumTasks);
+    }
+
+    SECTION("Tasks can schedule other tasks") {
+        std::atomic<int> count {0};
+        rdk::TaskScheduler scheduler(2);
+
+        scheduler.post([&scheduler, &count] {
+            for (int i = 0; i < 100; ++i) {
+                scheduler.post([&count] { count.fetch_add(1); });
+            }
+        });
+
+        wait_for(count, 100);
+        REQUIRE(count.load() == 100);
+    }
+
+    SECTION("A worker runs its own most recently scheduled task first") {
+        std::vector<int> order;
+        std::atomic<int> count {0};
+        rdk::TaskScheduler scheduler(1);
+
+        // More tasks than the initial capacity of a queue, so that the queue grows while wrapped around.
+        scheduler.post([&] {
+            for (int i = 0; i < 200; ++i) {
+                scheduler.post([&order, &count, i] {
+                    order.push_back(i);
+                    count.fetch_add(1);
+                });
+            }
+        });
+
+        wait_for(count, 200);
+        REQUIRE(order.size() == 200);
+        for (size_t i = 0; i < order.size(); ++i) {
+            REQUIRE(order[i] == static_cast<int>(order.size() - 1 - i));
+        }
+    }
+
+    SECTION("Scheduled task runs while the subscription is alive") {
+        std::promise<void> promise;
+        rdk::TaskScheduler scheduler(1);
+
+        auto subscription = scheduler.schedule([&promise] { promise.set_value(); });
+        REQUIRE(promise.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+    }
+
+    SECTION("Destroying the subscription cancels a pending task") {
+        std::promise<void> started;
+        std::promise<void> release;
+        std::atomic<int> count {0};
+
+        rdk::TaskScheduler scheduler(1);
+
+        // Block the only worker, so the next task stays pending.
+        scheduler.post([&] {
+            started.set_value();
+            release.get_future().wait();
+        });
+        started.get_future().wait();
+
+        {
+            auto subscription = scheduler.schedule([&count] { count.fetch_add(1); });
+        }
+
+        scheduler.post([&count] { count.fetch_add(10); });
+        release.set_value();
+
+        wait_for(count, 10);
+        REQUIRE(count.load() == 10);
+    }
+
+    SECTION("Destroying the subscription waits for a running task") {
+        std::promise<void> started;
+        std::atomic<bool> finished {false};
+
+        rdk::TaskScheduler scheduler(1);
+
+        auto subscription = scheduler.schedule([&] {
+            started.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            finished.store(true);
+        });
+
+        started.get_future().wait();
+        subscription.reset();
+        REQUIRE(finished.load());
+    }
+
+    SECTION("Waiting for a running task isn't ended by other tasks finishing") {
+        std::promise<void> started;
+        std::atomic<bool> finished {false};
+        std::atomic<int> count {0};
+
+        rdk::TaskScheduler scheduler(2);
+
+        auto subscription = scheduler.schedule([&] {
+            started.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            finished.store(true);
+        });
+
+        started.get_future().wait();
+        std::thread poster([&] {
+            for (int i = 0; i < 1000; ++i) {
+                scheduler.post([&count] { count.fetch_add(1); });
+            }
+        });
+        subscription.reset();
+        const auto finished_when_cancelled = finished.load();
+        poster.join();
+
+        REQUIRE(finished_when_cancelled);
+        wait_for(count, 1000);
+    }
+
+    SECTION("A task can cancel itself") {
+        std::atomic<int> count {0};
+        rdk::Subscription subscription;
+        std::mutex mutex;
+
+        rdk::TaskScheduler scheduler(1);
+
+        {
+            std::lock_guard lock(mutex);
+            subscription = scheduler.schedule([&] {
+                std::lock_guard task_lock(mutex);
+                subscription.reset();
+                count.fetch_add(1);
+            });
+        }
+
+        wait_for(count, 1);
+        REQUIRE_FALSE(subscription);
+    }
+
+    SECTION("Destroying the scheduler cancels pending tasks") {
+        std::promise<void> started;
+        std::atomic<int> count {0};
+        rdk::Subscription subscription;
+
+        {
+            rdk::TaskScheduler scheduler(1);
+
+            scheduler.post([&] {
+                started.set_value();
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            });
+            started.get_future().wait();
+
+            for (int i = 0; i < 10; ++i) {
+                scheduler.post([&count] { count.fetch_add(1); });
+            }
+            subscription = scheduler.schedule([&count] { count.fetch_add(1); });
+        }
+
+        REQUIRE(count.load() == 0);
+
+        // Subscriptions may outlive the scheduler.
+        subscription.reset();
+    }
+
+    SECTION("Delayed task runs after the delay") {
+        std::promise<void> promise;
+        rdk::TaskScheduler scheduler(2);
+
+        const auto start = std::chrono::steady_clock::now();
+        auto subscription = scheduler.schedule_after(std::chrono::milliseconds(20), [&promise] {
+            promise.set_value();
+        });
+
+        REQUIRE(promise.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+        REQUIRE(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(20));
+    }
+
+    SECTION("Delayed task doesn't run early when the timer thread wakes up for another timer") {
+        rdk::TaskScheduler scheduler(2);
+
+        // The shorter timer wakes up the timer thread one tick before the expiry of the longer timer, somewhere within
+        // the tick in which the longer timer's delay actually passes.
+        for (int i = 0; i < 20; ++i) {
+            std::promise<std::chrono::steady_clock::time_point> promise;
+            const auto start = std::chrono::steady_clock::now();
+            auto subscription = scheduler.schedule_after(std::chrono::milliseconds(2), [&promise] {
+                promise.set_value(std::chrono::steady_clock::now());
+            });
+            auto other = scheduler.schedule_after(std::chrono::milliseconds(1), [] {});
+
+            auto future = promise.get_future();
+            REQUIRE(future.wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+            REQUIRE(future.get() - start >= std::chrono::milliseconds(2));
+        }
+    }
+
+    SECTION("Destroying the subscription cancels a delayed task") {
+        std::atomic<int> count {0};
+        rdk::TaskScheduler scheduler(2);
+
+        {
+            auto subscription = scheduler.schedule_after(std::chrono::milliseconds(10), [&count] {
+                count.fetch_add(1);
+            });
+        }
+
+        auto other = scheduler.schedule_after(std::chrono::milliseconds(20), [&count] { count.fetch_add(10); });
+
+        wait_for(count, 10);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        REQUIRE(count.load() == 10);
+    }
+
+    SECTION("Periodic task runs until cancelled") {
+        std::atomic<int> count {0};
+        rdk::TaskScheduler scheduler(2);
+
+        auto subscription = scheduler.schedule_every(std::chrono::milliseconds(1), [&count] { count.fetch_add(1); });
+
+        wait_for(count, 5);
+        subscription.reset();
+
+        const auto count_after_cancel = count.load();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        REQUIRE(count.load() == count_after_cancel);
+    }
+
+    SECTION("Destroying the subscription waits for a running periodic task") {
+        std::promise<void> started;
+        std::atomic<bool> running {false};
+        std::atomic<int> count {0};
+
+        rdk::TaskScheduler scheduler(2);
+
+        auto subscription = scheduler.schedule_every(std::chrono::milliseconds(1), [&] {
+            running.store(true);
+            if (count.fetch_add(1) == 0) {
+                started.set_value();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            running.store(false);
+        });
+
+        started.get_future().wait();
+        subscription.reset();
+        REQUIRE_FALSE(running.load());
+    }
+
+    SECTION("A periodic task can cancel itself") {
+        std::atomic<int> count {0};
+        rdk::Subscription subscription;
+        std::mutex mutex;
+
+        rdk::TaskScheduler scheduler(1);
+
+        {
+            std::lock_guard lock(mutex);
+            subscription = scheduler.schedule_every(std::chrono::milliseconds(1), [&] {
+                std::lock_guard task_lock(mutex);
+                subscription.reset();
+                count.fetch_add(1);
+            });
+        }
+
+        wait_for(count, 1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        REQUIRE(count.load() == 1);
+    }
+
+    SECTION("Destroying the scheduler cancels pending timers") {
+        std::atomic<int> count {0};
+        rdk::Subscription subscription;
+
+        {
+            rdk::TaskScheduler scheduler(1);
+            subscription = scheduler.schedule_after(std::chrono::seconds(10), [&count] { count.fetch_add(1); });
+            scheduler.schedule_every(std::chrono::hours(1), [&count] { count.fetch_add(1); }).neutralize();
+        }
+
+        REQUIRE(count.load() == 0);
+        subscription.reset();
+    }
+}
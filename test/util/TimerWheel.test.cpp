@@ -0,0 +1,139 @@
+//
+// Created by Ruurd Adema on 17/10/2026.
+// Copyright (c) 2026 Sound on Digital. All rights reserved.
+//
+
+#include "rdk/util/TimerWheel.h"
+
+#include <catch2/catch_all.hpp>
+#include <map>
+#include <random>
+
+TEST_CASE("TimerWheel", "[TimerWheel]") {
+    rdk::TimerWheel<uint64_t> wheel(1000);
+    std::vector<std::pair<uint64_t, uint64_t>> expired;  // Value and tick at which it expired.
+
+    const auto on_expired = [&](const uint64_t value) {
+        expired.emplace_back(value, wheel.now());
+    };
+
+    REQUIRE(wheel.empty());
+    REQUIRE(wheel.now() == 1000);
+
+    SECTION("Timers expire at their expiry") {
+        const std::vector<uint64_t> expiries {1001, 1005, 1255, 1256, 1257, 2000, 65536, 70000, 20'000'000};
+        for (const auto expiry : expiries) {
+            wheel.arm(expiry, expiry);
+        }
+        REQUIRE(wheel.size() == expiries.size());
+
+        wheel.advance(1004, on_expired);
+        REQUIRE(expired.size() == 1);
+        REQUIRE(wheel.now() == 1004);
+
+        wheel.advance(30'000'000, on_expired);
+        REQUIRE(wheel.empty());
+        REQUIRE(expired.size() == expiries.size());
+
+        for (size_t i = 0; i < expiries.size(); ++i) {
+            REQUIRE(expired[i].first == expiries[i]);
+            REQUIRE(expired[i].second == expiries[i]);
+        }
+    }
+
+    SECTION("Timers in the past expire at the next tick") {
+        wheel.arm(10, 1);
+        wheel.arm(1000, 2);
+        wheel.advance(1001, on_expired);
+        REQUIRE(expired.size() == 2);
+        REQUIRE(expired[0].second == 1001);
+        REQUIRE(expired[1].second == 1001);
+    }
+
+    SECTION("Cancel") {
+        const auto a = wheel.arm(1010, 1);
+        const auto b = wheel.arm(1010, 2);
+        const auto c = wheel.arm(5000, 3);
+
+        REQUIRE(wheel.cancel(b));
+        REQUIRE_FALSE(wheel.cancel(b));
+        REQUIRE(wheel.cancel(c));
+        REQUIRE(wheel.size() == 1);
+
+        wheel.advance(10'000, on_expired);
+        REQUIRE(expired.size() == 1);
+        REQUIRE(expired[0].first == 1);
+        REQUIRE_FALSE(wheel.cancel(a));
+
+        // Ids of timers which expired or were cancelled don't match timers reusing the storage.
+        wheel.arm(20'000, 4);
+        REQUIRE_FALSE(wheel.cancel(a));
+        REQUIRE_FALSE(wheel.cancel(b));
+        REQUIRE_FALSE(wheel.cancel(c));
+        REQUIRE(wheel.size() == 1);
+    }
+
+    SECTION("Arm and cancel from within the callback") {
+        const std::vector ids {wheel.arm(1010, 1), wheel.arm(1010, 2), wheel.arm(1010, 3)};
+
+        wheel.advance(2000, [&](const uint64_t value) {
+            expired.emplace_back(value, wheel.now());
+            if (expired.size() == 1) {
+                // The first timer to expire cancels the others and arms a new one.
+                size_t num_cancelled = 0;
+                for (const auto& id : ids) {
+                    num_cancelled += wheel.cancel(id) ? 1 : 0;
+                }
+                REQUIRE(num_cancelled == 2);
+                wheel.arm(wheel.now() + 100, value + 10);
+            }
+        });
+
+        REQUIRE(expired.size() == 2);
+        REQUIRE(expired[1].first == expired[0].first + 10);
+        REQUIRE(expired[1].second == 1110);
+    }
+
+    SECTION("Next event") {
+        REQUIRE(wheel.next_event() == 1024);
+        wheel.arm(1003, 1);
+        REQUIRE(wheel.next_event() == 1003);
+        wheel.advance(1003, on_expired);
+        REQUIRE(wheel.next_event() == 1024);
+    }
+
+    SECTION("Randomized against a reference") {
+        std::mt19937_64 rng(42);
+        std::map<uint64_t, uint64_t> reference;  // Value to expiry.
+        std::vector<std::pair<rdk::TimerWheel<uint64_t>::TimerId, uint64_t>> ids;
+
+        for (uint64_t value = 0; value < 20'000; ++value) {
+            const auto range = uint64_t {1} << (rng() % 26);
+            const auto expiry = wheel.now() + 1 + rng() % range;
+            ids.emplace_back(wheel.arm(expiry, value), value);
+            reference[value] = expiry;
+
+            if (rng() % 4 == 0) {
+                const auto& [id, cancelled] = ids[rng() % ids.size()];
+                REQUIRE(wheel.cancel(id) == (reference.erase(cancelled) == 1));
+            }
+
+            if (rng() % 16 == 0) {
+                wheel.advance(wheel.now() + rng() % 1000, [&](const uint64_t expired_value) {
+                    REQUIRE(reference.at(expired_value) == wheel.now());
+                    reference.erase(expired_value);
+                });
+            }
+        }
+
+        REQUIRE(wheel.size() == reference.size());
+
+        wheel.advance(UINT32_MAX, [&](const uint64_t expired_value) {
+            REQUIRE(reference.at(expired_value) == wheel.now());
+            reference.erase(expired_value);
+        });
+
+        REQUIRE(reference.empty());
+        REQUIRE(wheel.empty());
+    }
+}